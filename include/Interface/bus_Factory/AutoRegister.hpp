@@ -55,11 +55,17 @@ template <typename Derived, typename Base>
 struct AutoRegister : Base {
   /**
    * @brief 이름을 받아 Derived 타입의 인스턴스를 동적 생성합니다.
+   *
+   * freezeSignals()를 제공하는 타입(IFrame 계열)은 생성 직후 신호 집합을
+   * 고정합니다.
    * @param name 객체 생성 시 사용할 이름
    * @return std::unique_ptr<Base> 생성된 객체의 베이스 클래스 포인터
    */
   static std::unique_ptr<Base> createInstance(const std::string& name) {
-    return std::make_unique<Derived>(name);
+    auto obj = std::make_unique<Derived>(name);
+    // 생성자에서 신호 등록이 끝났으므로 신호 테이블 고정 (IFrame 계열)
+    if constexpr (requires { obj->freezeSignals(); }) obj->freezeSignals();
+    return obj;
   }
 
   /**
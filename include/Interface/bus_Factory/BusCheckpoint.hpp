@@ -0,0 +1,413 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_BUS_FACTORY_BUSCHECKPOINT_HPP
+#define NEXUM_COM_EXTERNAL_BUS_FACTORY_BUSCHECKPOINT_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../frame/IFrame.h"
+#include "FrameBus.hpp"
+
+/**
+ * @brief FrameBus 전체 체크포인트 저장 / mmap 복원
+ *
+ * 버스의 모든 프레임 원시 데이터를 이름, 버전과 함께 파일 하나에 기록하고,
+ * 시작 시 파일을 mmap 하여 한 번의 순차 패스로 모든 프레임을 복원합니다.
+ *
+ * 파일 구조 (호스트 바이트 순서, 같은 빌드 간 재사용 전제):
+ * - Header: magic, 포맷 버전, 엔트리 수, 엔트리 테이블 체크섬
+ * - Entry[count]: 버전, 데이터/이름 위치, 크기, 데이터 체크섬
+ * - 이름 영역, 데이터 영역 (엔트리 순서대로, 16바이트 정렬)
+ *
+ * 저장은 임시 파일에 쓴 뒤 fsync + rename + 디렉터리 fsync 하므로 중간에
+ * 실패하거나 전원이 끊겨도 기존 체크포인트가 손상되지 않습니다.
+ *
+ * 저장된 데이터는 그 시점에 읽은 바이트 그대로이므로 모든 엔트리를
+ * 복원합니다. data()/rawData()로 직접 수정한 값도 버전과 무관하게
+ * 저장/복원됩니다. 엔트리의 버전은 저장 시점 IFrame::version()을 기록한
+ * 진단 정보(inspect)이며, 버전 카운터는 프로세스마다 0부터 다시 세므로
+ * 복원 시 비교하거나 되돌리지 않습니다.
+ */
+class BusCheckpoint {
+ public:
+  /**
+   * @brief 저장/복원 결과
+   */
+  struct Stats {
+    size_t frames = 0;      ///< 파일의 엔트리 수
+    size_t restored = 0;    ///< 복원된 프레임 수
+    size_t missing = 0;     ///< 버스에 없는 프레임 수
+    size_t mismatched = 0;  ///< 크기가 다른 프레임 수
+    size_t corrupt = 0;     ///< 데이터 체크섬 불일치 수
+    uint64_t bytes = 0;     ///< 파일 크기
+    double millis = 0;      ///< 소요 시간 (ms)
+  };
+
+  /**
+   * @brief 엔트리 정보 (inspect 결과)
+   */
+  struct EntryInfo {
+    std::string name;  ///< 프레임 이름
+    uint64_t version;  ///< 저장 시점의 프레임 버전 (진단용)
+    uint32_t size;     ///< 데이터 크기
+  };
+
+  /**
+   * @brief 버스의 모든 프레임을 파일로 저장
+   * @param path 체크포인트 파일 경로
+   * @param bus 대상 버스
+   * @throws std::runtime_error 파일 기록 실패 시
+   */
+  static Stats save(const std::string& path,
+                    const FrameBus& bus = FrameBus::instance());
+
+  /**
+   * @brief 체크포인트를 mmap 하여 버스의 프레임에 복원
+   *
+   * 헤더와 엔트리 테이블을 검증한 뒤 엔트리를 파일 순서대로 적용합니다.
+   * 데이터 체크섬이 맞지 않거나 크기가 다른 엔트리는 건너뜁니다.
+   * @param path 체크포인트 파일 경로
+   * @param bus 대상 버스
+   * @param publish true면 복원한 프레임마다 notifyCallbacks 호출
+   * @throws std::runtime_error 파일 열기 실패, 형식/테이블 체크섬 오류 시
+   */
+  static Stats restore(const std::string& path,
+                       FrameBus& bus = FrameBus::instance(),
+                       bool publish = false);
+
+  /**
+   * @brief 체크포인트 엔트리 목록 조회 (검증 포함, 적용 없음)
+   * @throws std::runtime_error 형식/테이블 체크섬 오류 시
+   */
+  static std::vector<EntryInfo> inspect(const std::string& path);
+
+ private:
+  static constexpr char kMagic[8] = {'N', 'X', 'C', 'K', 'P', 'T', 0, 0};
+  static constexpr uint32_t kFormatVersion = 1;
+  static constexpr size_t kAlign = 16;
+
+  struct Header {
+    char magic[8];
+    uint32_t formatVersion;
+    uint32_t count;
+    uint64_t fileSize;
+    uint64_t tableChecksum;  ///< Entry 테이블 + 이름 영역
+  };
+
+  struct Entry {
+    uint64_t version;
+    uint64_t dataOffset;
+    uint64_t nameOffset;
+    uint32_t size;
+    uint32_t nameLen;
+    uint64_t dataChecksum;
+  };
+
+  /** @brief 읽기 전용 mmap 영역 (RAII) */
+  class Mapping {
+   public:
+    explicit Mapping(const std::string& path);
+    ~Mapping() {
+      if (base_ && base_ != MAP_FAILED) ::munmap(base_, size_);
+    }
+    Mapping(const Mapping&) = delete;
+    Mapping& operator=(const Mapping&) = delete;
+    const char* data() const { return static_cast<const char*>(base_); }
+    size_t size() const { return size_; }
+
+   private:
+    void* base_ = nullptr;
+    size_t size_ = 0;
+  };
+
+  static uint64_t checksum(const void* data, size_t size);
+  static size_t alignUp(size_t n) { return (n + kAlign - 1) & ~(kAlign - 1); }
+  static const Entry* validate(const Mapping& map);
+  static void syncParentDir(const std::string& path);
+};
+
+// ------------------- BusCheckpoint 구현부 -------------------
+
+/**
+ * @brief 64비트 워드 단위 FNV-1a 변형 (손상 검출용, 암호학적 용도 아님)
+ */
+inline uint64_t BusCheckpoint::checksum(const void* data, size_t size) {
+  const auto* p = static_cast<const unsigned char*>(data);
+  uint64_t h = 1469598103934665603ull ^ size;
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    uint64_t w;
+    std::memcpy(&w, p + i, 8);
+    h = (h ^ w) * 1099511628211ull;
+    h ^= h >> 29;
+  }
+  for (; i < size; ++i) h = (h ^ p[i]) * 1099511628211ull;
+  return h;
+}
+
+inline BusCheckpoint::Stats BusCheckpoint::save(const std::string& path,
+                                                const FrameBus& bus) {
+  const auto t0 = std::chrono::steady_clock::now();
+  std::vector<std::pair<std::string, std::shared_ptr<IFrame>>> frames;
+  bus.forEach([&](const std::string& name, std::shared_ptr<IFrame> frame) {
+    if (frame) frames.emplace_back(name, std::move(frame));
+  });
+  std::sort(frames.begin(), frames.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  // 레이아웃 계산: Header | Entry[n] | 이름 | 데이터
+  const size_t n = frames.size();
+  size_t namesBytes = 0;
+  for (const auto& f : frames) namesBytes += f.first.size();
+  const size_t tableOffset = sizeof(Header);
+  const size_t namesOffset = tableOffset + n * sizeof(Entry);
+  size_t dataOffset = alignUp(namesOffset + namesBytes);
+
+  std::vector<Entry> entries(n);
+  std::vector<char> image(dataOffset);
+  size_t namePos = namesOffset;
+  for (size_t i = 0; i < n; ++i) {
+    const auto& [name, frame] = frames[i];
+    Entry& e = entries[i];
+    e.nameOffset = namePos;
+    e.nameLen = static_cast<uint32_t>(name.size());
+    std::memcpy(&image[namePos], name.data(), name.size());
+    namePos += name.size();
+    // 데이터와 버전을 같은 읽기 구간에서 취득
+    frame->readRawData([&](const char* p, size_t size) {
+      e.version = frame->version();
+      e.size = static_cast<uint32_t>(size);
+      e.dataOffset = dataOffset;
+      image.resize(alignUp(dataOffset + size));
+      std::memcpy(&image[dataOffset], p, size);
+      e.dataChecksum = checksum(p, size);
+    });
+    dataOffset = image.size();
+  }
+  std::memcpy(&image[tableOffset], entries.data(), n * sizeof(Entry));
+
+  Header h{};
+  std::memcpy(h.magic, kMagic, sizeof(kMagic));
+  h.formatVersion = kFormatVersion;
+  h.count = static_cast<uint32_t>(n);
+  h.fileSize = image.size();
+  h.tableChecksum =
+      checksum(&image[tableOffset], n * sizeof(Entry) + namesBytes);
+  std::memcpy(image.data(), &h, sizeof(h));
+
+  const std::string tmp = path + ".tmp";
+  const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    throw std::runtime_error("BusCheckpoint: cannot create " + tmp + ": " +
+                             std::strerror(errno));
+  size_t written = 0;
+  while (written < image.size()) {
+    const ssize_t w =
+        ::write(fd, image.data() + written, image.size() - written);
+    if (w < 0 && errno == EINTR) continue;
+    if (w <= 0) {
+      const int err = errno;
+      ::close(fd);
+      ::unlink(tmp.c_str());
+      throw std::runtime_error("BusCheckpoint: write failed: " +
+                               std::string(std::strerror(err)));
+    }
+    written += static_cast<size_t>(w);
+  }
+  const bool synced = ::fsync(fd) == 0;
+  ::close(fd);
+  if (!synced || std::rename(tmp.c_str(), path.c_str()) != 0) {
+    ::unlink(tmp.c_str());
+    throw std::runtime_error("BusCheckpoint: cannot commit " + path);
+  }
+  syncParentDir(path);  // rename 자체를 디스크에 반영
+
+  Stats s;
+  s.frames = n;
+  s.bytes = image.size();
+  s.millis = std::chrono::duration<double, std::milli>(
+                 std::chrono::steady_clock::now() - t0)
+                 .count();
+  return s;
+}
+
+/**
+ * @brief path가 있는 디렉터리 fsync (rename 영속화)
+ * @throws std::runtime_error 디렉터리 열기/fsync 실패 시
+ */
+inline void BusCheckpoint::syncParentDir(const std::string& path) {
+  std::string dir = std::filesystem::path(path).parent_path().string();
+  if (dir.empty()) dir = ".";
+  const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+  if (fd < 0)
+    throw std::runtime_error("BusCheckpoint: cannot open directory " + dir +
+                             ": " + std::strerror(errno));
+  const bool synced = ::fsync(fd) == 0;
+  const int err = errno;
+  ::close(fd);
+  if (!synced)
+    throw std::runtime_error("BusCheckpoint: directory fsync failed: " +
+                             std::string(std::strerror(err)));
+}
+
+inline BusCheckpoint::Mapping::Mapping(const std::string& path) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("BusCheckpoint: cannot open " + path + ": " +
+                             std::strerror(errno));
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 || st.st_size < 0) {
+    ::close(fd);
+    throw std::runtime_error("BusCheckpoint: cannot stat " + path);
+  }
+  size_ = static_cast<size_t>(st.st_size);
+  if (size_ > 0) {
+    base_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd,
+                   0);
+  }
+  ::close(fd);
+  if (base_ == MAP_FAILED)
+    throw std::runtime_error("BusCheckpoint: mmap failed: " + path);
+  if (base_) ::madvise(base_, size_, MADV_SEQUENTIAL);
+}
+
+inline const BusCheckpoint::Entry* BusCheckpoint::validate(
+    const Mapping& map) {
+  Header h;
+  if (map.size() < sizeof(h))
+    throw std::runtime_error("BusCheckpoint: file too small");
+  std::memcpy(&h, map.data(), sizeof(h));
+  if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 ||
+      h.formatVersion != kFormatVersion)
+    throw std::runtime_error("BusCheckpoint: not a checkpoint file");
+  if (h.fileSize != map.size())
+    throw std::runtime_error("BusCheckpoint: truncated file");
+  const size_t tableBytes = size_t(h.count) * sizeof(Entry);
+  if (sizeof(h) + tableBytes > map.size())
+    throw std::runtime_error("BusCheckpoint: corrupt entry table");
+  const auto* entries = reinterpret_cast<const Entry*>(map.data() + sizeof(h));
+  size_t namesBytes = 0;
+  for (uint32_t i = 0; i < h.count; ++i) {
+    const Entry& e = entries[i];
+    if (e.nameOffset + e.nameLen > map.size() ||
+        e.dataOffset + e.size > map.size())
+      throw std::runtime_error("BusCheckpoint: entry out of range");
+    namesBytes += e.nameLen;
+  }
+  if (sizeof(h) + tableBytes + namesBytes > map.size() ||
+      checksum(map.data() + sizeof(h), tableBytes + namesBytes) !=
+          h.tableChecksum)
+    throw std::runtime_error("BusCheckpoint: entry table checksum mismatch");
+  return entries;
+}
+
+inline BusCheckpoint::Stats BusCheckpoint::restore(const std::string& path,
+                                                   FrameBus& bus,
+                                                   bool publish) {
+  const auto t0 = std::chrono::steady_clock::now();
+  Mapping map(path);
+  const Entry* entries = validate(map);
+  Header h;
+  std::memcpy(&h, map.data(), sizeof(h));
+
+  Stats s;
+  s.frames = h.count;
+  s.bytes = map.size();
+  std::string name;
+  for (uint32_t i = 0; i < h.count; ++i) {  // 데이터 영역을 순서대로 1회 통과
+    const Entry& e = entries[i];
+    name.assign(map.data() + e.nameOffset, e.nameLen);
+    std::shared_ptr<IFrame> frame = bus.getFrame(name);
+    if (!frame) {
+      ++s.missing;
+      continue;
+    }
+    const char* src = map.data() + e.dataOffset;
+    if (checksum(src, e.size) != e.dataChecksum) {
+      ++s.corrupt;
+      continue;
+    }
+    bool applied = false;
+    frame->writeRawData([&](char* dst, size_t size) {
+      if (size != e.size) return;
+      std::memcpy(dst, src, size);
+      applied = true;
+    });
+    if (!applied) {
+      ++s.mismatched;
+      continue;
+    }
+    ++s.restored;
+    if (publish) frame->notifyCallbacks();
+  }
+  s.millis = std::chrono::duration<double, std::milli>(
+                 std::chrono::steady_clock::now() - t0)
+                 .count();
+  return s;
+}
+
+inline std::vector<BusCheckpoint::EntryInfo> BusCheckpoint::inspect(
+    const std::string& path) {
+  Mapping map(path);
+  const Entry* entries = validate(map);
+  Header h;
+  std::memcpy(&h, map.data(), sizeof(h));
+  std::vector<EntryInfo> out;
+  out.reserve(h.count);
+  for (uint32_t i = 0; i < h.count; ++i)
+    out.push_back({std::string(map.data() + entries[i].nameOffset,
+                               entries[i].nameLen),
+                   entries[i].version, entries[i].size});
+  return out;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_BUS_FACTORY_BUSCHECKPOINT_HPP
@@ -38,23 +38,40 @@
 #ifndef NEXUM_COM_EXTERNAL_BUS_FACTORY_FRAMEBUS_HPP
 #define NEXUM_COM_EXTERNAL_BUS_FACTORY_FRAMEBUS_HPP
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
-class IFrame;
+#include "../frame/IFrame.h"
 
 /**
  * @brief IFrame 객체의 싱글톤 레지스트리(버스) 역할을 하는 클래스
  *
  * FrameBus는 이름 기반으로 IFrame 객체를 등록/조회/삭제/순회할 수 있는
- * 싱글톤 레지스트리입니다. 멀티스레드 환경에서도 안전하게 사용할 수 있도록
- * 내부적으로 mutex로 보호됩니다.
+ * 싱글톤 레지스트리입니다. 이름 해시로 kShardCount개의 샤드에 분산되며,
+ * 각 샤드는 독립된 캐시 라인에 놓인 shared_mutex로 보호됩니다.
+ * 서로 다른 샤드에 대한 조회/등록은 경합하지 않고, 같은 샤드의 조회끼리도
+ * 공유 락으로 병행됩니다.
  */
 class FrameBus {
  public:
+  /** @brief 샤드 수 (2의 거듭제곱) */
+  static constexpr size_t kShardCount = 64;
+
+  /** @brief 프레임 순회 콜백 타입 */
+  using Visitor =
+      std::function<void(const std::string&, std::shared_ptr<IFrame>)>;
+
   /**
    * @brief FrameBus의 전역 싱글톤 인스턴스를 반환합니다.
    * @return FrameBus& 싱글톤 객체 참조
@@ -66,12 +83,26 @@ class FrameBus {
 
   /**
    * @brief 프레임을 이름으로 등록합니다. (기존 이름이 있으면 덮어쓰기)
+   *
+   * 처음 등록되는 프레임에는 버스 순번(IFrame::busOrder)이 부여되며,
+   * PublishBatch는 이 순서로 알림을 보냅니다. 이때 신호 집합도
+   * 고정(IFrame::freezeSignals)하므로 FactoryRegistry를 거치지 않고
+   * 직접 만든 프레임도 완전 해시 조회를 씁니다. 첫 등록 전에는 프레임을
+   * 다른 스레드와 공유하지 않아야 합니다.
    * @param name 프레임 식별자
    * @param frame 등록할 IFrame 객체 (shared_ptr)
    */
   void registerFrame(const std::string& name, std::shared_ptr<IFrame> frame) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    frames_[name] = std::move(frame);
+    if (frame) {
+      uint64_t unset = UINT64_MAX;
+      if (frame->busOrder_.compare_exchange_strong(
+              unset, nextOrder_.fetch_add(1, std::memory_order_relaxed),
+              std::memory_order_relaxed))
+        frame->freezeSignals();
+    }
+    Shard& shard = shardFor(name);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.frames[name] = std::move(frame);
   }
 
   /**
@@ -80,9 +111,10 @@ class FrameBus {
    * @return std::shared_ptr<IFrame> 찾은 경우 프레임 포인터, 없으면 nullptr
    */
   std::shared_ptr<IFrame> getFrame(const std::string& name) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = frames_.find(name);
-    if (it != frames_.end()) return it->second;
+    const Shard& shard = shardFor(name);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.frames.find(name);
+    if (it != shard.frames.end()) return it->second;
     return nullptr;
   }
 
@@ -91,23 +123,86 @@ class FrameBus {
    * @param name 프레임 식별자
    */
   void unregisterFrame(const std::string& name) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    frames_.erase(name);
+    Shard& shard = shardFor(name);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.frames.erase(name);
   }
 
   /**
    * @brief 등록된 모든 프레임에 대해 콜백을 수행합니다.
+   *
+   * 샤드 단위로 락을 잡으므로 전체 버스의 원자적 스냅샷은 아닙니다.
+   * @param cb (프레임 이름, 프레임 객체)로 호출되는 함수/람다
+   */
+  void forEach(const Visitor& cb) const {
+    for (size_t i = 0; i < kShardCount; ++i) forEachInShard(i, cb);
+  }
+
+  /**
+   * @brief 지정 샤드의 프레임에 대해 콜백을 수행합니다.
+   * @param shardIndex 샤드 인덱스 (0 ~ kShardCount-1)
    * @param cb (프레임 이름, 프레임 객체)로 호출되는 함수/람다
    */
-  void forEach(const std::function<void(const std::string&,
-                                        std::shared_ptr<IFrame>)>& cb) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto& kv : frames_) {
+  void forEachInShard(size_t shardIndex, const Visitor& cb) const {
+    const Shard& shard = shards_[shardIndex];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    for (const auto& kv : shard.frames) {
       cb(kv.first, kv.second);
     }
   }
 
+  /**
+   * @brief 샤드를 여러 스레드에 나누어 병렬로 순회합니다.
+   *
+   * 콜백이 예외를 던지면 각 스레드는 남은 샤드를 건너뛰고, 모든 스레드를
+   * join한 뒤 처음 포착된 예외를 호출자에게 다시 던집니다.
+   * @param cb 스레드 안전한 콜백 (호출 순서 미정)
+   * @param threads 사용할 스레드 수 (0이면 hardware_concurrency)
+   */
+  void parallelForEach(const Visitor& cb, size_t threads = 0) const {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads <= 1) return forEach(cb);
+    if (threads > kShardCount) threads = kShardCount;
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    std::atomic<bool> failed{false};
+    auto capture = [&] {
+      std::lock_guard<std::mutex> lock(errorMutex);
+      if (!error) error = std::current_exception();
+      failed.store(true, std::memory_order_relaxed);
+    };
+    auto visit = [&](size_t first) {
+      try {
+        for (size_t i = first; i < kShardCount; i += threads) {
+          if (failed.load(std::memory_order_relaxed)) return;
+          forEachInShard(i, cb);
+        }
+      } catch (...) {
+        capture();
+      }
+    };
+    std::vector<std::thread> workers;
+    try {
+      workers.reserve(threads - 1);
+      for (size_t t = 1; t < threads; ++t) workers.emplace_back(visit, t);
+    } catch (...) {
+      capture();  // 스레드 생성 실패: 이미 띄운 스레드는 아래에서 join
+    }
+    visit(0);
+    for (auto& w : workers) w.join();
+    if (error) std::rethrow_exception(error);
+  }
+
  private:
+  /**
+   * @brief 캐시 라인 단위로 분리된 레지스트리 샤드
+   */
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;  ///< 샤드 락
+    std::unordered_map<std::string, std::shared_ptr<IFrame>>
+        frames;  ///< 이름 기반 IFrame 객체 레지스트리
+  };
+
   /**
    * @brief FrameBus의 private 생성자 (싱글톤 패턴)
    */
@@ -115,10 +210,17 @@ class FrameBus {
   FrameBus(const FrameBus&) = delete;
   FrameBus& operator=(const FrameBus&) = delete;
 
-  /** @brief 동기화를 위한 mutex */
-  mutable std::mutex mutex_;
-  /** @brief 이름 기반 IFrame 객체 레지스트리 */
-  std::unordered_map<std::string, std::shared_ptr<IFrame>> frames_;
+  static size_t shardIndex(const std::string& name) {
+    return std::hash<std::string>{}(name) & (kShardCount - 1);
+  }
+  Shard& shardFor(const std::string& name) { return shards_[shardIndex(name)]; }
+  const Shard& shardFor(const std::string& name) const {
+    return shards_[shardIndex(name)];
+  }
+
+  /** @brief 이름 해시 기반 샤드 배열 */
+  std::array<Shard, kShardCount> shards_;
+  std::atomic<uint64_t> nextOrder_{0};  ///< 다음 버스 순번
 };
 
 #endif
\ No newline at end of file
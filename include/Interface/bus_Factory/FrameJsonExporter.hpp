@@ -0,0 +1,353 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_BUS_FACTORY_FRAMEJSONEXPORTER_HPP
+#define NEXUM_COM_EXTERNAL_BUS_FACTORY_FRAMEJSONEXPORTER_HPP
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../frame/IFrame.h"
+#include "FrameBus.hpp"
+
+/**
+ * @brief 프레임/버스 JSON 내보내기 (진단용)
+ *
+ * getSignal()과 std::any 변환 대신 프레임의 신호 디스크립터 테이블을 따라
+ * 원시 데이터에서 값을 직접 읽고 std::to_chars로 재사용 버퍼에 기록합니다.
+ * 프레임 데이터는 먼저 락 없이(tryReadVersioned) 복사하고, 쓰기와 겹치면
+ * readRawData로 다시 복사한 뒤 락 밖에서 포매팅합니다. 신호마다 최대 출력
+ * 길이만큼 버퍼를 확보하고 포인터로 직접 기록하므로 문자 단위 용량 검사가
+ * 없습니다.
+ *
+ * 출력 형식:
+ * - 프레임: {"신호명":값,...} (등록 순서)
+ * - 버스: {"프레임명":{...},...} (샤드 순회 순서)
+ * - 정수/bool은 숫자/true·false, 실수는 최단 왕복 표기 (NaN/Inf는 null)
+ * - std::array 신호는 JSON 배열, Bytes 타입은 16진 문자열
+ *
+ * @note 한 객체는 한 스레드에서만 사용해야 합니다.
+ */
+class FrameJsonExporter {
+ public:
+  /** @brief 스트리밍 출력 함수 (조각은 호출 이후 무효) */
+  using Sink = std::function<void(std::string_view)>;
+
+  /** @brief streamBus 기본 조각 크기 (바이트) */
+  static constexpr size_t kDefaultChunkBytes = 64 * 1024;
+
+  /**
+   * @brief 프레임 하나를 out 끝에 JSON 객체로 추가
+   */
+  void appendFrame(std::string& out, const IFrame& frame) {
+    size_t len = out.size();
+    writeFrame(out, len, frame);
+    out.resize(len);
+  }
+
+  /**
+   * @brief 프레임 하나를 내부 버퍼에 JSON으로 기록
+   * @return 다음 export 호출 전까지 유효한 결과
+   */
+  std::string_view exportFrame(const IFrame& frame) {
+    size_t len = 0;
+    writeFrame(buffer_, len, frame);
+    return {buffer_.data(), len};
+  }
+
+  /**
+   * @brief 버스 전체를 내부 버퍼에 JSON으로 기록
+   * @return 다음 export 호출 전까지 유효한 결과
+   */
+  std::string_view exportBus(const FrameBus& bus = FrameBus::instance()) {
+    size_t len = 0;
+    writeBus(bus, nullptr, 0, len);
+    return {buffer_.data(), len};
+  }
+
+  /**
+   * @brief 버스 전체를 조각 단위로 sink에 전달
+   *
+   * 샤드 하나를 순회할 때마다 버퍼가 chunkBytes 이상이면 sink를 호출하고
+   * 버퍼를 비웁니다. sink는 샤드 락 밖에서 호출되므로 버스를 수정해도
+   * 됩니다. 모든 조각을 이어 붙이면 exportBus와 같은 문서가 됩니다.
+   * @param sink 조각 출력 함수
+   * @param bus 대상 버스
+   * @param chunkBytes 조각 전달 임계 크기
+   * @return 내보낸 프레임 수
+   */
+  size_t streamBus(const Sink& sink,
+                   const FrameBus& bus = FrameBus::instance(),
+                   size_t chunkBytes = kDefaultChunkBytes) {
+    size_t len = 0;
+    const size_t frames = writeBus(bus, &sink, chunkBytes, len);
+    sink({buffer_.data(), len});
+    return frames;
+  }
+
+  /**
+   * @brief 문자열을 JSON 문자열 리터럴로 out 끝에 추가
+   */
+  static void appendString(std::string& out, std::string_view s) {
+    size_t len = out.size();
+    len = writeString(room(out, len, s.size() * 6 + 2), s) - out.data();
+    out.resize(len);
+  }
+
+  /**
+   * @brief 원소 하나를 JSON 값으로 out 끝에 추가
+   * @param type 원소 타입 태그
+   * @param p 원소 시작 위치
+   * @param size 원소 크기 (바이트)
+   */
+  static void appendValue(std::string& out, SignalType type,
+                          const std::byte* p, size_t size) {
+    size_t len = out.size();
+    char* w = room(out, len, valueBound(type, size));
+    len = writeValue(w, type, p, size) - out.data();
+    out.resize(len);
+  }
+
+ private:
+  /** @brief 숫자 1개의 최대 표기 길이 ("-1.7976931348623157e+308") */
+  static constexpr size_t kNumberBound = 24;
+
+  /** @brief room()이 늘릴 때 추가로 확보하는 여유 (바이트) */
+  static constexpr size_t kRoomSlack = 256;
+
+  /**
+   * @brief out[len..]에 n바이트 이상 여유를 확보하고 쓰기 위치 반환
+   *
+   * 모자랄 때만 kRoomSlack을 더해 늘리며 (재할당은 std::string의 용량
+   * 증가 정책을 따름), 재사용 버퍼는 이전 크기를 유지하므로 거의 늘지
+   * 않습니다.
+   */
+  static char* room(std::string& out, size_t len, size_t n) {
+    if (out.size() < len + n) out.resize(len + n + kRoomSlack);
+    return out.data() + len;
+  }
+
+  static size_t valueBound(SignalType type, size_t size) {
+    return type == SignalType::Bytes ? size * 2 + 2 : kNumberBound;
+  }
+
+  void writeFrame(std::string& out, size_t& len, const IFrame& frame);
+  size_t writeBus(const FrameBus& bus, const Sink* sink, size_t chunkBytes,
+                  size_t& len);
+  static char* writeString(char* w, std::string_view s);
+  static char* writeValue(char* w, SignalType type, const std::byte* p,
+                          size_t size);
+
+  template <typename T>
+  static char* writeNumber(char* w, const std::byte* p) {
+    T v;
+    std::memcpy(&v, p, sizeof(T));
+    if constexpr (std::is_floating_point_v<T>) {
+      if (!std::isfinite(v)) {
+        std::memcpy(w, "null", 4);
+        return w + 4;
+      }
+    }
+    return std::to_chars(w, w + kNumberBound, v).ptr;
+  }
+
+  std::string buffer_;          ///< export 결과 버퍼 (재사용)
+  std::vector<std::byte> raw_;  ///< 프레임 데이터 복사본 (재사용)
+};
+
+// ------------------- FrameJsonExporter 구현부 -------------------
+
+/**
+ * @brief 프레임 하나를 out[len..]에 기록하고 len 갱신
+ */
+inline void FrameJsonExporter::writeFrame(std::string& out, size_t& len,
+                                          const IFrame& frame) {
+  raw_.resize(frame.size());
+  size_t copied = raw_.size();
+  uint64_t version;
+  if (!frame.tryReadVersioned(raw_, version)) {
+    frame.readRawData([&](const char* p, size_t n) {
+      copied = n < raw_.size() ? n : raw_.size();
+      std::memcpy(raw_.data(), p, copied);
+    });
+  }
+
+  *room(out, len, 1) = '{';
+  ++len;
+  bool first = true;
+  for (const auto& e : frame.signalEntries()) {
+    const SignalDescriptor& d = e.desc;
+    if (size_t{d.offset} + d.size > copied || d.count == 0) continue;
+    const size_t elem = d.size / d.count;
+    // ,"이름":[값,...]} 의 최대 길이
+    const size_t bound = e.name.size() * 6 + 7 +
+                         d.count * (valueBound(d.type, elem) + 1);
+    char* w = room(out, len, bound);
+    if (!first) *w++ = ',';
+    first = false;
+    w = writeString(w, e.name);
+    *w++ = ':';
+    const std::byte* p = raw_.data() + d.offset;
+    if (d.count == 1) {
+      w = writeValue(w, d.type, p, d.size);
+    } else {
+      *w++ = '[';
+      for (uint32_t i = 0; i < d.count; ++i) {
+        if (i) *w++ = ',';
+        w = writeValue(w, d.type, p + i * elem, elem);
+      }
+      *w++ = ']';
+    }
+    len = w - out.data();
+  }
+  *room(out, len, 1) = '}';
+  ++len;
+}
+
+/**
+ * @brief 버스 전체를 buffer_에 기록 (sink가 있으면 샤드마다 조각 전달)
+ */
+inline size_t FrameJsonExporter::writeBus(const FrameBus& bus,
+                                          const Sink* sink, size_t chunkBytes,
+                                          size_t& len) {
+  size_t frames = 0;
+  *room(buffer_, len, 1) = '{';
+  ++len;
+  for (size_t i = 0; i < FrameBus::kShardCount; ++i) {
+    bus.forEachInShard(
+        i, [&](const std::string& name, const std::shared_ptr<IFrame>& f) {
+          if (!f) return;
+          char* w = room(buffer_, len, name.size() * 6 + 4);
+          if (frames++) *w++ = ',';
+          w = writeString(w, name);
+          *w++ = ':';
+          len = w - buffer_.data();
+          writeFrame(buffer_, len, *f);
+        });
+    if (sink && len >= chunkBytes) {
+      (*sink)({buffer_.data(), len});
+      len = 0;
+    }
+  }
+  *room(buffer_, len, 1) = '}';
+  ++len;
+  return frames;
+}
+
+/**
+ * @brief JSON 문자열 리터럴 기록 (w에 s.size() * 6 + 2 바이트 여유 필요)
+ */
+inline char* FrameJsonExporter::writeString(char* w, std::string_view s) {
+  static constexpr char kHex[] = "0123456789abcdef";
+  *w++ = '"';
+  size_t plain = 0;  // 이스케이프가 필요 없는 구간 시작
+  for (size_t i = 0; i < s.size(); ++i) {
+    const unsigned char c = static_cast<unsigned char>(s[i]);
+    if (c >= 0x20 && c != '"' && c != '\\') continue;
+    std::memcpy(w, s.data() + plain, i - plain);
+    w += i - plain;
+    plain = i + 1;
+    *w++ = '\\';
+    if (c == '"' || c == '\\') {
+      *w++ = static_cast<char>(c);
+    } else {
+      const char esc[5] = {'u', '0', '0', kHex[c >> 4], kHex[c & 15]};
+      std::memcpy(w, esc, sizeof(esc));
+      w += sizeof(esc);
+    }
+  }
+  std::memcpy(w, s.data() + plain, s.size() - plain);
+  w += s.size() - plain;
+  *w++ = '"';
+  return w;
+}
+
+/**
+ * @brief 원소 하나 기록 (w에 valueBound(type, size) 바이트 여유 필요)
+ */
+inline char* FrameJsonExporter::writeValue(char* w, SignalType type,
+                                           const std::byte* p, size_t size) {
+  switch (type) {
+    case SignalType::Bool:
+      if (p[0] != std::byte{0}) {
+        std::memcpy(w, "true", 4);
+        return w + 4;
+      }
+      std::memcpy(w, "false", 5);
+      return w + 5;
+    case SignalType::Int8:
+      return writeNumber<int8_t>(w, p);
+    case SignalType::UInt8:
+      return writeNumber<uint8_t>(w, p);
+    case SignalType::Int16:
+      return writeNumber<int16_t>(w, p);
+    case SignalType::UInt16:
+      return writeNumber<uint16_t>(w, p);
+    case SignalType::Int32:
+      return writeNumber<int32_t>(w, p);
+    case SignalType::UInt32:
+      return writeNumber<uint32_t>(w, p);
+    case SignalType::Int64:
+      return writeNumber<int64_t>(w, p);
+    case SignalType::UInt64:
+      return writeNumber<uint64_t>(w, p);
+    case SignalType::Float:
+      return writeNumber<float>(w, p);
+    case SignalType::Double:
+      return writeNumber<double>(w, p);
+    case SignalType::Bytes:
+      break;
+  }
+  static constexpr char kHex[] = "0123456789abcdef";
+  *w++ = '"';
+  for (size_t i = 0; i < size; ++i) {
+    const auto b = static_cast<unsigned char>(p[i]);
+    *w++ = kHex[b >> 4];
+    *w++ = kHex[b & 15];
+  }
+  *w++ = '"';
+  return w;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_BUS_FACTORY_FRAMEJSONEXPORTER_HPP
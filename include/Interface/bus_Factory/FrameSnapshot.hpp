@@ -0,0 +1,314 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_BUS_FACTORY_FRAMESNAPSHOT_HPP
+#define NEXUM_COM_EXTERNAL_BUS_FACTORY_FRAMESNAPSHOT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "../frame/IFrame.h"
+#include "FrameBus.hpp"
+
+/**
+ * @brief 여러 프레임에 걸친 일관된 스냅샷 (버전 기반 double-collect)
+ *
+ * 1) 각 프레임을 seqlock 방식으로 락 없이 복사하며 버전을 기록하고,
+ * 2) 모든 프레임에서 그 버전 이후 새 쓰기가 시작되지 않았음을 확인합니다.
+ * 두 단계 사이에 쓰기가 없었으므로 모든 복사본은 같은 시점의 상태입니다.
+ * 실패하면 바뀐 프레임만 다시 복사하여 재시도하고, 이전 capture 이후 버전이
+ * 변하지 않은 프레임은 복사를 생략합니다.
+ *
+ * 읽기는 쓰기를 막지 않습니다. 단, maxRetries 동안 계속 경합하면
+ * (fallbackToLocks가 true일 때) 프레임 주소 순으로 공유 락을 모두 잡고
+ * 복사하여 진행을 보장하며, 이 경우에만 잠시 쓰기가 대기합니다.
+ * AtomicFrameBase처럼 락이 없는 프레임과 Atomic 신호는 락으로 배제되지
+ * 않으므로, 대체 경로도 복사 후 버전을 다시 검증하고 계속 바뀌면 false를
+ * 반환합니다. AtomicFrameBase의 버전은 발행(notifyCallbacks)마다 오르므로
+ * 발행하지 않은 store는 검증에 드러나지 않습니다.
+ *
+ * @note 한 스냅샷 객체는 한 스레드에서만 사용해야 합니다.
+ */
+class FrameSnapshot {
+ public:
+  /**
+   * @brief capture 통계
+   */
+  struct Stats {
+    uint64_t captures = 0;   ///< capture 호출 수
+    uint64_t retries = 0;    ///< 검증 실패로 인한 재시도 수
+    uint64_t copies = 0;     ///< 프레임 복사 수
+    uint64_t skipped = 0;    ///< 버전 불변으로 생략한 복사 수
+    uint64_t fallbacks = 0;  ///< 락 기반 대체 경로 사용 수
+  };
+
+  /**
+   * @brief FrameBus의 프레임 이름으로 구성
+   * @throws std::invalid_argument 버스에 없는 프레임이 있을 때
+   */
+  FrameSnapshot(const std::vector<std::string>& names,
+                const FrameBus& bus = FrameBus::instance());
+
+  /**
+   * @brief 프레임 객체로 직접 구성 (names는 frames와 같은 순서)
+   */
+  FrameSnapshot(std::vector<std::shared_ptr<IFrame>> frames,
+                std::vector<std::string> names);
+
+  /**
+   * @brief 일관된 스냅샷 갱신
+   * @param maxRetries 락 없는 시도 횟수
+   * @param fallbackToLocks 시도 소진 시 락 기반 복사 여부
+   * @return 일관된 스냅샷을 얻었으면 true. 시도를 소진했는데 fallback을
+   *         쓰지 않거나, fallback 중에도 락 없는 프레임이 maxRetries회
+   *         검증에 실패하면 false (이 경우 스냅샷 내용은 보장되지 않음)
+   */
+  bool capture(size_t maxRetries = 64, bool fallbackToLocks = true);
+
+  /**
+   * @brief 프레임 수
+   */
+  size_t size() const { return frames_.size(); }
+
+  /**
+   * @brief i번째 프레임의 스냅샷 데이터
+   */
+  std::span<const std::byte> data(size_t i) const {
+    return {buffers_[i].data(), sizes_[i]};
+  }
+
+  /**
+   * @brief 이름으로 스냅샷 데이터 조회
+   * @throws std::out_of_range 없는 이름
+   */
+  std::span<const std::byte> data(const std::string& name) const {
+    return data(indexOf(name));
+  }
+
+  /**
+   * @brief 스냅샷 데이터를 T로 복사해 반환 (프레임 데이터 타입과 같아야 함)
+   * @throws std::runtime_error 크기 불일치
+   */
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  T as(const std::string& name) const {
+    const auto d = data(name);
+    if (d.size() != sizeof(T))
+      throw std::runtime_error("FrameSnapshot: size mismatch for " + name);
+    T out;
+    std::memcpy(&out, d.data(), sizeof(T));
+    return out;
+  }
+
+  /**
+   * @brief i번째 프레임의 스냅샷 버전
+   */
+  uint64_t version(size_t i) const { return versions_[i]; }
+
+  /**
+   * @brief 이름의 인덱스
+   * @throws std::out_of_range 없는 이름
+   */
+  size_t indexOf(const std::string& name) const { return index_.at(name); }
+
+  /**
+   * @brief 누적 통계
+   */
+  const Stats& stats() const { return stats_; }
+
+ private:
+  void init();
+  bool collect(std::vector<size_t>& stale);
+  bool captureLocked(size_t maxRetries);
+
+  std::vector<std::shared_ptr<IFrame>> frames_;
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, size_t> index_;
+  std::vector<std::vector<std::byte>> buffers_;
+  std::vector<size_t> sizes_;
+  std::vector<uint64_t> versions_;
+  std::vector<bool> valid_;     ///< 이전 capture 결과 보유 여부
+  std::vector<size_t> byAddr_;  ///< 락 순서 (프레임 주소 오름차순)
+  Stats stats_;
+};
+
+// ------------------- FrameSnapshot 구현부 -------------------
+
+inline FrameSnapshot::FrameSnapshot(const std::vector<std::string>& names,
+                                    const FrameBus& bus)
+    : names_(names) {
+  for (const auto& name : names_) {
+    auto frame = bus.getFrame(name);
+    if (!frame)
+      throw std::invalid_argument("FrameSnapshot: unknown frame " + name);
+    frames_.push_back(std::move(frame));
+  }
+  init();
+}
+
+inline FrameSnapshot::FrameSnapshot(
+    std::vector<std::shared_ptr<IFrame>> frames, std::vector<std::string> names)
+    : frames_(std::move(frames)), names_(std::move(names)) {
+  if (names_.size() != frames_.size())
+    throw std::invalid_argument("FrameSnapshot: names/frames size mismatch");
+  for (const auto& f : frames_)
+    if (!f) throw std::invalid_argument("FrameSnapshot: null frame");
+  init();
+}
+
+inline void FrameSnapshot::init() {
+  const size_t n = frames_.size();
+  buffers_.resize(n);
+  sizes_.resize(n);
+  versions_.assign(n, 0);
+  valid_.assign(n, false);
+  for (size_t i = 0; i < n; ++i) {
+    index_[names_[i]] = i;
+    sizes_[i] = frames_[i]->size();
+    buffers_[i].resize(sizes_[i]);
+  }
+  byAddr_.resize(n);
+  std::iota(byAddr_.begin(), byAddr_.end(), size_t{0});
+  std::sort(byAddr_.begin(), byAddr_.end(), [this](size_t a, size_t b) {
+    return std::less<const IFrame*>()(frames_[a].get(), frames_[b].get());
+  });
+}
+
+/**
+ * @brief 1단계: stale 프레임을 락 없이 복사 (실패 시 stale에 남김)
+ * @return 모든 stale 프레임 복사 성공 여부
+ */
+inline bool FrameSnapshot::collect(std::vector<size_t>& stale) {
+  bool ok = true;
+  size_t keep = 0;
+  for (size_t i : stale) {
+    if (frames_[i]->tryReadVersioned(buffers_[i], versions_[i])) {
+      valid_[i] = true;
+      ++stats_.copies;
+    } else {
+      valid_[i] = false;
+      stale[keep++] = i;
+      ok = false;
+    }
+  }
+  stale.resize(keep);
+  return ok;
+}
+
+inline bool FrameSnapshot::capture(size_t maxRetries, bool fallbackToLocks) {
+  ++stats_.captures;
+  const size_t n = frames_.size();
+  std::vector<size_t> stale;
+  for (size_t i = 0; i < n; ++i) {
+    if (valid_[i] && frames_[i]->unchangedSince(versions_[i])) {
+      ++stats_.skipped;  // 이전 capture 이후 쓰기 없음
+    } else {
+      stale.push_back(i);
+    }
+  }
+
+  for (size_t attempt = 0; attempt <= maxRetries; ++attempt) {
+    if (attempt > 0) {
+      ++stats_.retries;
+      std::this_thread::yield();
+    }
+    if (!collect(stale)) continue;
+    // 2단계: 복사 이후 어느 프레임에도 새 쓰기가 시작되지 않았는지 확인
+    for (size_t i = 0; i < n; ++i)
+      if (!frames_[i]->unchangedSince(versions_[i])) stale.push_back(i);
+    if (stale.empty()) return true;
+  }
+  if (!fallbackToLocks) return false;
+  return captureLocked(maxRetries);
+}
+
+/**
+ * @brief 대체 경로: 주소 순으로 모든 공유 락을 잡은 뒤 복사
+ *
+ * 락은 벡터에 보관하므로 프레임 수와 무관하게 스택 사용이 일정합니다.
+ * 락을 보유한 동안 락 기반 쓰기는 없으므로 버전 읽기는 원자 신호
+ * 쓰기와 겹칠 때만 재시도합니다. 락이 없는 프레임은 readRawData로
+ * 복사합니다. 락으로 막히지 않는 쓰기(락 없는 프레임, Atomic 신호)가
+ * 있었을 수 있으므로 락을 쥔 채 전체 버전을 다시 검증하고, 바뀐 프레임만
+ * 최대 maxRetries회 다시 복사합니다.
+ * @return 재검증 통과 여부
+ */
+inline bool FrameSnapshot::captureLocked(size_t maxRetries) {
+  ++stats_.fallbacks;
+  std::vector<std::shared_lock<std::shared_mutex>> locks;
+  locks.reserve(byAddr_.size());
+  for (size_t i : byAddr_) {
+    auto lock = frames_[i]->lockShared();
+    if (lock.owns_lock()) {
+      while (!frames_[i]->tryReadVersioned(buffers_[i], versions_[i]))
+        std::this_thread::yield();
+    } else {
+      frames_[i]->readRawData([&](const char* p, size_t size) {
+        std::memcpy(buffers_[i].data(), p, std::min(size, buffers_[i].size()));
+        versions_[i] = frames_[i]->version();
+      });
+    }
+    valid_[i] = true;
+    ++stats_.copies;
+    locks.push_back(std::move(lock));
+  }
+  std::vector<size_t> stale;
+  for (size_t attempt = 0;; ++attempt) {
+    stale.clear();
+    for (size_t i = 0; i < frames_.size(); ++i)
+      if (!frames_[i]->unchangedSince(versions_[i])) stale.push_back(i);
+    if (stale.empty()) return true;
+    if (attempt == maxRetries) return false;
+    ++stats_.retries;
+    std::this_thread::yield();
+    collect(stale);  // 실패한 프레임은 valid_가 false로 남음
+  }
+}
+
+#endif  // NEXUM_COM_EXTERNAL_BUS_FACTORY_FRAMESNAPSHOT_HPP
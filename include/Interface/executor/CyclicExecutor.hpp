@@ -0,0 +1,544 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_EXECUTOR_CYCLICEXECUTOR_HPP
+#define NEXUM_COM_EXTERNAL_EXECUTOR_CYCLICEXECUTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../bus_Factory/FrameSnapshot.hpp"
+#include "../frame/PublishBatch.hpp"
+#include "IExecutor.h"
+
+/**
+ * @brief 다중 주기 러너블 실행기 (AUTOSAR 스타일 rate group)
+ *
+ * 같은 주기의 러너블은 하나의 rate group으로 묶여 등록 순서대로 실행됩니다.
+ * 각 사이클은 다음 순서로 진행됩니다.
+ * 1) 그룹 입력 프레임 전체를 FrameSnapshot으로 일관되게 캡처 (락 없음)
+ * 2) PublishBatch 범위 안에서 러너블 실행 (입력은 스냅샷에서만 읽음)
+ * 3) 범위 종료 시 사이클 동안 publish된 출력 프레임을 한 번씩 알림
+ *
+ * 사이클은 실행기에 dispatch되며, 우선순위는 rate-monotonic(짧은 주기가
+ * 높음), 마감은 release + deadline입니다. DeadlineScheduler와 함께 쓰면
+ * 빠른 주기가 느린 주기보다 먼저 워커를 얻습니다.
+ * 이전 사이클이 끝나기 전에 다음 release가 오면 그 release는 건너뛰고
+ * skipped로 집계하며, 마감을 넘겨 끝난 사이클은 overrun으로 집계합니다.
+ *
+ * start()는 실시간 타이머 스레드로 release하고, 외부 타이머나
+ * SimulationRuntime에서는 releaseDue()/runCycle()을 직접 호출합니다.
+ */
+class CyclicExecutor {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using Duration = std::chrono::nanoseconds;
+  using GroupId = size_t;
+
+  /**
+   * @brief 러너블 실행 문맥 (사이클 동안 불변)
+   */
+  class Context {
+   public:
+    /** @brief 그룹 입력 스냅샷 */
+    const FrameSnapshot& inputs() const { return inputs_; }
+
+    /**
+     * @brief 입력 프레임 데이터를 T로 복사
+     * @throws std::out_of_range 그룹 입력이 아닌 프레임
+     */
+    template <typename T>
+    T input(const std::string& frame) const {
+      return inputs_.as<T>(frame);
+    }
+
+    /** @brief 그룹 사이클 번호 (0부터) */
+    uint64_t cycle() const { return cycle_; }
+    /** @brief 이번 사이클 release 시각 */
+    Clock::time_point release() const { return release_; }
+    /** @brief 이번 사이클 마감 시각 */
+    Clock::time_point deadline() const { return deadline_; }
+    /** @brief 그룹 주기 */
+    Duration period() const { return period_; }
+
+   private:
+    friend class CyclicExecutor;
+    Context(const FrameSnapshot& inputs, uint64_t cycle,
+            Clock::time_point release, Clock::time_point deadline,
+            Duration period)
+        : inputs_(inputs),
+          cycle_(cycle),
+          release_(release),
+          deadline_(deadline),
+          period_(period) {}
+
+    const FrameSnapshot& inputs_;
+    uint64_t cycle_;
+    Clock::time_point release_;
+    Clock::time_point deadline_;
+    Duration period_;
+  };
+
+  /** @brief 러너블 함수 타입 */
+  using Runnable = std::function<void(const Context&)>;
+
+  /**
+   * @brief 러너블 통계
+   */
+  struct RunnableStats {
+    std::string name;     ///< 러너블 이름
+    uint64_t runs = 0;    ///< 실행 수
+    uint64_t errors = 0;  ///< 예외 수
+    Duration minExec = Duration::max();  ///< 최소 실행 시간
+    Duration maxExec{0};                 ///< 최대 실행 시간
+    Duration totalExec{0};               ///< 누적 실행 시간
+  };
+
+  /**
+   * @brief rate group 통계
+   */
+  struct GroupStats {
+    Duration period{0};          ///< 주기
+    uint64_t releases = 0;       ///< release 수
+    uint64_t cycles = 0;         ///< 완료한 사이클 수
+    uint64_t skipped = 0;        ///< 이전 사이클 미완료로 건너뛴 release
+    uint64_t overruns = 0;       ///< 마감 초과 사이클 수
+    Duration maxJitter{0};       ///< 최대 시작 지연 (release → 시작)
+    Duration maxResponse{0};     ///< 최대 응답 시간 (release → 완료)
+    Duration totalResponse{0};   ///< 누적 응답 시간
+    uint64_t snapshotRetries = 0;    ///< 입력 스냅샷 재시도 수
+    uint64_t snapshotFallbacks = 0;  ///< 입력 스냅샷 락 대체 경로 수
+  };
+
+  /**
+   * @brief 마감 초과 핸들러 (그룹, 초과 시간) - 실행 스레드에서 호출
+   */
+  using OverrunHandler = std::function<void(GroupId, Duration)>;
+
+  /**
+   * @brief 생성자
+   * @param executor 사이클을 실행할 실행기 (CyclicExecutor보다 오래 살아야 함)
+   * @param bus 입력 프레임을 조회할 버스
+   */
+  explicit CyclicExecutor(IExecutor& executor,
+                          const FrameBus& bus = FrameBus::instance())
+      : executor_(executor), bus_(bus) {}
+
+  /**
+   * @brief 소멸자 (stop)
+   */
+  ~CyclicExecutor() { stop(); }
+
+  CyclicExecutor(const CyclicExecutor&) = delete;
+  CyclicExecutor& operator=(const CyclicExecutor&) = delete;
+
+  /**
+   * @brief rate group 추가 (start 이전에만)
+   * @param period 주기 (0보다 커야 함)
+   * @param offset 첫 release 지연 (주기 간 부하 분산용)
+   * @param deadline 상대 마감 (0이면 주기)
+   * @return 그룹 ID
+   * @throws std::invalid_argument period가 0 이하일 때
+   * @throws std::logic_error 실행 중일 때
+   */
+  GroupId addRateGroup(Duration period, Duration offset = {},
+                       Duration deadline = {});
+
+  /**
+   * @brief 그룹에 러너블 추가 (등록 순서대로 실행, start 이전에만)
+   * @param group 그룹 ID
+   * @param name 러너블 이름 (통계용)
+   * @param fn 러너블
+   * @param inputs 읽을 입력 프레임 이름 (그룹 스냅샷에 합쳐짐)
+   * @throws std::out_of_range 없는 그룹
+   * @throws std::logic_error 실행 중일 때
+   */
+  void addRunnable(GroupId group, std::string name, Runnable fn,
+                   const std::vector<std::string>& inputs = {});
+
+  /**
+   * @brief 마감 초과 핸들러 설정 (start 이전에만)
+   */
+  void setOverrunHandler(OverrunHandler handler) {
+    overrunHandler_ = std::move(handler);
+  }
+
+  /**
+   * @brief 입력 스냅샷을 준비하고 실시간 타이머 스레드 시작
+   * @throws std::invalid_argument 버스에 없는 입력 프레임이 있을 때
+   */
+  void start();
+
+  /**
+   * @brief 타이머를 멈추고 실행 중인 사이클이 끝날 때까지 대기
+   */
+  void stop();
+
+  /**
+   * @brief now까지 도래한 release를 모두 실행기에 제출 (외부 타이머용)
+   *
+   * 여러 주기를 놓친 그룹은 한 번만 release하고 나머지는 skipped로 집계합니다.
+   */
+  void releaseDue(Clock::time_point now);
+
+  /**
+   * @brief 그룹 한 사이클을 호출 스레드에서 바로 실행
+   * @return 이전 사이클이 실행 중이면 false (skipped 집계)
+   * @throws std::invalid_argument 버스에 없는 입력 프레임이 있을 때
+   */
+  bool runCycle(GroupId group, Clock::time_point release = Clock::now());
+
+  /**
+   * @brief 그룹 수
+   */
+  size_t groupCount() const { return groups_.size(); }
+
+  /**
+   * @brief 그룹 통계
+   */
+  GroupStats groupStats(GroupId group) const;
+
+  /**
+   * @brief 그룹의 러너블 통계 (실행 순서)
+   */
+  std::vector<RunnableStats> runnableStats(GroupId group) const;
+
+ private:
+  struct Entry {
+    RunnableStats stats;
+    Runnable fn;
+    Duration lastExec{0};  ///< 이번 사이클 실행 시간
+    bool lastOk = true;    ///< 이번 사이클 성공 여부
+  };
+
+  struct Group {
+    Duration period;
+    Duration offset;
+    Duration deadline;
+    DispatchAttr attr;                        ///< rate-monotonic 우선순위
+    std::vector<std::string> inputs;          ///< 입력 프레임 (중복 없음)
+    std::vector<Entry> runnables;
+    std::unique_ptr<FrameSnapshot> snapshot;  ///< 실행 중인 사이클만 사용
+    std::atomic<bool> busy{false};            ///< 사이클 실행 중 여부
+    Clock::time_point nextRelease;
+    uint64_t cycle = 0;
+    mutable std::mutex statsMtx;
+    GroupStats stats;
+  };
+
+  Group& group(GroupId id) const;
+  void checkNotRunning() const;
+  void prepare();
+  void timerLoop();
+  void execute(Group& g, GroupId id, Clock::time_point release);
+  Duration runGroup(Group& g, Clock::time_point release);
+  void endCycle();
+
+  IExecutor& executor_;
+  const FrameBus& bus_;
+  std::vector<std::unique_ptr<Group>> groups_;
+  OverrunHandler overrunHandler_;
+
+  std::mutex mtx_;               ///< 타이머 / 진행 중 사이클 대기
+  std::condition_variable cv_;   ///< stop 알림, 사이클 완료 알림
+  bool running_ = false;         ///< 타이머 실행 여부
+  size_t inflight_ = 0;          ///< 제출 후 완료되지 않은 사이클 수
+  std::thread timer_;
+};
+
+// ------------------- CyclicExecutor 구현부 -------------------
+
+inline CyclicExecutor::Group& CyclicExecutor::group(GroupId id) const {
+  if (id >= groups_.size())
+    throw std::out_of_range("CyclicExecutor: unknown group");
+  return *groups_[id];
+}
+
+inline void CyclicExecutor::checkNotRunning() const {
+  if (timer_.joinable())
+    throw std::logic_error("CyclicExecutor: cannot modify while running");
+}
+
+inline CyclicExecutor::GroupId CyclicExecutor::addRateGroup(Duration period,
+                                                            Duration offset,
+                                                            Duration deadline) {
+  checkNotRunning();
+  if (period <= Duration::zero())
+    throw std::invalid_argument("CyclicExecutor: period must be positive");
+  auto g = std::make_unique<Group>();
+  g->period = period;
+  g->offset = offset;
+  g->deadline = deadline > Duration::zero() ? deadline : period;
+  g->stats.period = period;
+  groups_.push_back(std::move(g));
+
+  // rate-monotonic: 주기가 짧을수록 높은 우선순위
+  for (auto& a : groups_) {
+    int rank = 0;
+    for (auto& b : groups_)
+      if (b->period > a->period) ++rank;
+    a->attr.priority = rank;
+    a->attr.deadline = a->deadline;
+  }
+  return groups_.size() - 1;
+}
+
+inline void CyclicExecutor::addRunnable(
+    GroupId id, std::string name, Runnable fn,
+    const std::vector<std::string>& inputs) {
+  checkNotRunning();
+  Group& g = group(id);
+  for (const auto& in : inputs)
+    if (std::find(g.inputs.begin(), g.inputs.end(), in) == g.inputs.end())
+      g.inputs.push_back(in);
+  g.snapshot.reset();  // 입력 변경: 다음 준비 때 다시 구성
+  Entry e;
+  e.stats.name = std::move(name);
+  e.fn = std::move(fn);
+  g.runnables.push_back(std::move(e));
+}
+
+inline void CyclicExecutor::prepare() {
+  for (auto& g : groups_)
+    if (!g->snapshot)
+      g->snapshot = std::make_unique<FrameSnapshot>(g->inputs, bus_);
+}
+
+inline void CyclicExecutor::start() {
+  if (timer_.joinable()) return;
+  prepare();
+  const auto now = Clock::now();
+  for (auto& g : groups_) g->nextRelease = now + g->offset;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    running_ = true;
+  }
+  timer_ = std::thread([this] { timerLoop(); });
+}
+
+inline void CyclicExecutor::stop() {
+  {
+    std::unique_lock<std::mutex> lock(mtx_);
+    running_ = false;
+    cv_.notify_all();
+  }
+  if (timer_.joinable()) timer_.join();
+  std::unique_lock<std::mutex> lock(mtx_);
+  cv_.wait(lock, [this] { return inflight_ == 0; });
+}
+
+inline void CyclicExecutor::timerLoop() {
+  std::unique_lock<std::mutex> lock(mtx_);
+  while (running_) {
+    auto next = Clock::time_point::max();
+    for (auto& g : groups_) next = std::min(next, g->nextRelease);
+    if (cv_.wait_until(lock, next, [this] { return !running_; })) break;
+    lock.unlock();
+    try {
+      releaseDue(Clock::now());
+    } catch (...) {  // 실행기 종료: 더 이상 release하지 않음
+      lock.lock();
+      break;
+    }
+    lock.lock();
+  }
+}
+
+inline void CyclicExecutor::releaseDue(Clock::time_point now) {
+  for (GroupId id = 0; id < groups_.size(); ++id) {
+    Group& g = *groups_[id];
+    if (g.nextRelease > now) continue;
+    const Clock::time_point release = g.nextRelease;
+    // 놓친 주기는 건너뛰고 다음 release를 now 이후로 맞춤
+    const uint64_t missed = static_cast<uint64_t>((now - release) / g.period);
+    g.nextRelease = release + g.period * (missed + 1);
+    {
+      std::lock_guard<std::mutex> lock(g.statsMtx);
+      g.stats.releases += missed + 1;
+      g.stats.skipped += missed;
+    }
+    if (g.busy.exchange(true, std::memory_order_acquire)) {
+      std::lock_guard<std::mutex> lock(g.statsMtx);
+      ++g.stats.skipped;
+      continue;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      ++inflight_;
+    }
+    DispatchAttr attr = g.attr;
+    attr.release = release;
+    try {
+      executor_.dispatch(
+          [this, &g, id, release] {
+            struct End {
+              CyclicExecutor* self;
+              ~End() { self->endCycle(); }
+            } end{this};  // 사이클 예외 시에도 stop 대기 해제
+            execute(g, id, release);
+          },
+          attr);
+    } catch (...) {  // 실행기 종료 등
+      g.busy.store(false, std::memory_order_release);
+      endCycle();
+      throw;
+    }
+  }
+}
+
+inline bool CyclicExecutor::runCycle(GroupId id, Clock::time_point release) {
+  Group& g = group(id);
+  {
+    std::lock_guard<std::mutex> lock(g.statsMtx);
+    ++g.stats.releases;
+  }
+  if (g.busy.exchange(true, std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(g.statsMtx);
+    ++g.stats.skipped;
+    return false;
+  }
+  if (!g.snapshot) {
+    try {
+      g.snapshot = std::make_unique<FrameSnapshot>(g.inputs, bus_);
+    } catch (...) {
+      g.busy.store(false, std::memory_order_release);
+      throw;
+    }
+  }
+  execute(g, id, release);
+  return true;
+}
+
+inline void CyclicExecutor::endCycle() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  --inflight_;
+  cv_.notify_all();
+}
+
+/**
+ * @brief 한 사이클 실행 (호출 전 busy를 획득해야 하며, 예외 시에도 해제)
+ */
+inline void CyclicExecutor::execute(Group& g, GroupId id,
+                                    Clock::time_point release) {
+  Duration lateness;
+  {
+    struct Done {
+      std::atomic<bool>& busy;
+      ~Done() { busy.store(false, std::memory_order_release); }
+    } done{g.busy};
+    lateness = runGroup(g, release);
+  }
+  if (lateness > Duration::zero() && overrunHandler_)
+    overrunHandler_(id, lateness);
+}
+
+/**
+ * @brief 사이클 본체: 입력 캡처, 러너블 실행, 통계 갱신
+ * @return 마감 대비 지연 (양수면 overrun)
+ */
+inline CyclicExecutor::Duration CyclicExecutor::runGroup(
+    Group& g, Clock::time_point release) {
+  const auto start = Clock::now();
+  FrameSnapshot& in = *g.snapshot;
+  const auto before = in.stats();
+  in.capture();
+  const Context ctx(in, g.cycle++, release, release + g.deadline, g.period);
+
+  {
+    PublishBatch batch;  // 출력은 사이클 끝에 프레임당 한 번 publish
+    for (auto& e : g.runnables) {
+      const auto t0 = Clock::now();
+      e.lastOk = true;
+      try {
+        e.fn(ctx);
+      } catch (...) {
+        e.lastOk = false;  // 한 러너블의 실패가 사이클을 멈추지 않음
+      }
+      e.lastExec = Clock::now() - t0;
+    }
+  }
+  const auto end = Clock::now();
+  const auto& after = in.stats();
+  const Duration lateness = end - ctx.deadline();
+  {
+    std::lock_guard<std::mutex> lock(g.statsMtx);
+    for (auto& e : g.runnables) {
+      RunnableStats& s = e.stats;
+      ++s.runs;
+      if (!e.lastOk) ++s.errors;
+      s.minExec = std::min(s.minExec, e.lastExec);
+      s.maxExec = std::max(s.maxExec, e.lastExec);
+      s.totalExec += e.lastExec;
+    }
+    GroupStats& s = g.stats;
+    ++s.cycles;
+    s.maxJitter = std::max<Duration>(s.maxJitter, start - release);
+    s.maxResponse = std::max<Duration>(s.maxResponse, end - release);
+    s.totalResponse += end - release;
+    s.snapshotRetries += after.retries - before.retries;
+    s.snapshotFallbacks += after.fallbacks - before.fallbacks;
+    if (lateness > Duration::zero()) ++s.overruns;
+  }
+  return lateness;
+}
+
+inline CyclicExecutor::GroupStats CyclicExecutor::groupStats(
+    GroupId id) const {
+  const Group& g = group(id);
+  std::lock_guard<std::mutex> lock(g.statsMtx);
+  return g.stats;
+}
+
+inline std::vector<CyclicExecutor::RunnableStats>
+CyclicExecutor::runnableStats(GroupId id) const {
+  const Group& g = group(id);
+  std::lock_guard<std::mutex> lock(g.statsMtx);
+  std::vector<RunnableStats> out;
+  out.reserve(g.runnables.size());
+  for (const auto& e : g.runnables) out.push_back(e.stats);
+  return out;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_EXECUTOR_CYCLICEXECUTOR_HPP
@@ -0,0 +1,293 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_EXECUTOR_DEADLINESCHEDULER_HPP
+#define NEXUM_COM_EXTERNAL_EXECUTOR_DEADLINESCHEDULER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "IExecutor.h"
+
+/**
+ * @brief 우선순위 클래스 + EDF(Earliest Deadline First) 스케줄러
+ *
+ * 작업은 (우선순위 내림차순, 절대 마감 시각 오름차순, 제출 순) 으로
+ * 실행됩니다. 마감이 없는 작업은 같은 우선순위 안에서 가장 늦게 실행됩니다.
+ *
+ * reservedWorkers개의 워커는 criticalPriority 이상 작업만 실행하므로,
+ * 일반 워커가 벌크 작업으로 포화되어도 중요 구독의 지연이 제한됩니다.
+ * 완료 시각이 마감을 넘긴 작업은 마감 위반으로 집계되고, 설정된 경우
+ * 위반 핸들러가 호출됩니다.
+ */
+class DeadlineScheduler : public IExecutor {
+ public:
+  /**
+   * @brief 우선순위 클래스별 통계
+   */
+  struct ClassStats {
+    int priority;           ///< 우선순위 클래스
+    uint64_t executed;      ///< 실행한 작업 수
+    uint64_t misses;        ///< 마감 위반 수
+    double avgLatencyUs;    ///< 평균 대기 지연 (release → 시작, us)
+    double maxLatencyUs;    ///< 최대 대기 지연 (us)
+    double maxLatenessUs;   ///< 최대 마감 초과 시간 (us)
+  };
+
+  /**
+   * @brief 마감 위반 핸들러 (속성, 초과 시간)
+   */
+  using MissHandler =
+      std::function<void(const DispatchAttr&, std::chrono::nanoseconds)>;
+
+  /**
+   * @brief 생성자
+   * @param workers 전체 워커 수 (0이면 hardware_concurrency)
+   * @param reservedWorkers 중요 작업 전용 워커 수 (workers보다 작아야 함)
+   * @param criticalPriority 중요 작업으로 보는 최소 우선순위
+   */
+  explicit DeadlineScheduler(size_t workers = 0, size_t reservedWorkers = 0,
+                             int criticalPriority = 100);
+
+  /**
+   * @brief 소멸자 (남은 작업 실행 후 워커 종료)
+   */
+  ~DeadlineScheduler() override;
+
+  DeadlineScheduler(const DeadlineScheduler&) = delete;
+  DeadlineScheduler& operator=(const DeadlineScheduler&) = delete;
+
+  /**
+   * @brief 작업 제출 (우선순위 0, 마감 없음)
+   */
+  void post(Task task) override;
+
+  /**
+   * @brief 우선순위 / 마감 속성과 함께 작업 제출
+   * @throws std::runtime_error 종료 이후 제출 시
+   */
+  void dispatch(Task task, const DispatchAttr& attr) override;
+
+  /**
+   * @brief 마감 위반 핸들러 설정 (워커 스레드에서 호출됨)
+   */
+  void setMissHandler(MissHandler handler);
+
+  /**
+   * @brief 남은 작업을 모두 실행하고 워커 종료
+   */
+  void shutdown();
+
+  /**
+   * @brief 대기 중인 작업 수
+   */
+  size_t pending() const;
+
+  /**
+   * @brief 우선순위 클래스별 통계 (우선순위 내림차순)
+   */
+  std::vector<ClassStats> stats() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Item {
+    int priority;
+    Clock::time_point due;  ///< 절대 마감 (없으면 time_point::max)
+    uint64_t seq;
+    DispatchAttr attr;
+    Task task;
+  };
+
+  struct Later {
+    bool operator()(const Item& a, const Item& b) const {
+      if (a.priority != b.priority) return a.priority < b.priority;
+      if (a.due != b.due) return a.due > b.due;
+      return a.seq > b.seq;
+    }
+  };
+
+  struct Counters {
+    uint64_t executed = 0;
+    uint64_t misses = 0;
+    double latencySumNs = 0;
+    double maxLatencyNs = 0;
+    double maxLatenessNs = 0;
+  };
+
+  void workerLoop(bool reserved);
+  bool runnable(bool reserved) const;
+
+  const int criticalPriority_;
+  mutable std::mutex mtx_;
+  std::condition_variable cv_;
+  std::priority_queue<Item, std::vector<Item>, Later> queue_;
+  uint64_t nextSeq_ = 0;
+  bool stop_ = false;
+  MissHandler missHandler_;
+  std::map<int, Counters> counters_;  ///< 우선순위 클래스별 카운터
+  std::vector<std::thread> workers_;
+};
+
+// ------------------- DeadlineScheduler 구현부 -------------------
+
+inline DeadlineScheduler::DeadlineScheduler(size_t workers,
+                                            size_t reservedWorkers,
+                                            int criticalPriority)
+    : criticalPriority_(criticalPriority) {
+  if (workers == 0) workers = std::max(1u, std::thread::hardware_concurrency());
+  if (reservedWorkers >= workers)
+    throw std::invalid_argument(
+        "DeadlineScheduler: reservedWorkers must be less than workers");
+  workers_.reserve(workers);
+  for (size_t i = 0; i < workers; ++i) {
+    const bool reserved = i < reservedWorkers;
+    workers_.emplace_back([this, reserved] { workerLoop(reserved); });
+  }
+}
+
+inline DeadlineScheduler::~DeadlineScheduler() { shutdown(); }
+
+inline void DeadlineScheduler::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (auto& w : workers_)
+    if (w.joinable() && w.get_id() != std::this_thread::get_id()) w.join();
+}
+
+inline void DeadlineScheduler::post(Task task) {
+  dispatch(std::move(task), DispatchAttr{});
+}
+
+inline void DeadlineScheduler::dispatch(Task task, const DispatchAttr& attr) {
+  DispatchAttr a = attr;
+  if (a.release == Clock::time_point{}) a.release = Clock::now();
+  const Clock::time_point due = a.deadline.count() > 0
+                                    ? a.release + a.deadline
+                                    : Clock::time_point::max();
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (stop_)
+      throw std::runtime_error("DeadlineScheduler: dispatch after shutdown");
+    queue_.push({a.priority, due, nextSeq_++, a, std::move(task)});
+  }
+  // 전용 워커는 중요 작업만 받으므로 깨울 대상을 고를 수 없어 전체 알림
+  cv_.notify_all();
+}
+
+inline void DeadlineScheduler::setMissHandler(MissHandler handler) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  missHandler_ = std::move(handler);
+}
+
+inline size_t DeadlineScheduler::pending() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return queue_.size();
+}
+
+inline bool DeadlineScheduler::runnable(bool reserved) const {
+  if (queue_.empty()) return false;
+  return !reserved || queue_.top().priority >= criticalPriority_;
+}
+
+inline void DeadlineScheduler::workerLoop(bool reserved) {
+  for (;;) {
+    Item item;
+    MissHandler onMiss;
+    {
+      std::unique_lock<std::mutex> lock(mtx_);
+      cv_.wait(lock, [&] { return stop_ || runnable(reserved); });
+      if (!runnable(reserved)) {
+        if (stop_ && (queue_.empty() || reserved)) break;
+        continue;
+      }
+      item = std::move(const_cast<Item&>(queue_.top()));
+      queue_.pop();
+      onMiss = missHandler_;
+    }
+    const Clock::time_point start = Clock::now();
+    try {
+      item.task();
+    } catch (...) {
+    }
+    const Clock::time_point end = Clock::now();
+    const double latency =
+        std::chrono::duration<double, std::nano>(start - item.attr.release)
+            .count();
+    const bool missed = end > item.due;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      Counters& c = counters_[item.priority];
+      ++c.executed;
+      c.latencySumNs += latency;
+      c.maxLatencyNs = std::max(c.maxLatencyNs, latency);
+      if (missed) {
+        ++c.misses;
+        c.maxLatenessNs = std::max(
+            c.maxLatenessNs,
+            std::chrono::duration<double, std::nano>(end - item.due).count());
+      }
+    }
+    if (missed && onMiss) onMiss(item.attr, end - item.due);
+  }
+}
+
+inline std::vector<DeadlineScheduler::ClassStats> DeadlineScheduler::stats()
+    const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  std::vector<ClassStats> out;
+  for (auto it = counters_.rbegin(); it != counters_.rend(); ++it) {
+    const Counters& c = it->second;
+    out.push_back({it->first, c.executed, c.misses,
+                   c.executed ? c.latencySumNs / c.executed / 1e3 : 0.0,
+                   c.maxLatencyNs / 1e3, c.maxLatenessNs / 1e3});
+  }
+  return out;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_EXECUTOR_DEADLINESCHEDULER_HPP
@@ -0,0 +1,99 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_EXECUTOR_IEXECUTOR_H
+#define NEXUM_COM_EXTERNAL_EXECUTOR_IEXECUTOR_H
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+class Strand;
+
+/**
+ * @brief 작업 디스패치 속성 (우선순위 / 상대 마감 시간)
+ */
+struct DispatchAttr {
+  int priority = 0;                      ///< 우선순위 클래스 (클수록 먼저)
+  std::chrono::nanoseconds deadline{0};  ///< release 기준 마감 시간 (0: 없음)
+  /** @brief 마감 기준 시각 (기본값이면 제출 시각) */
+  std::chrono::steady_clock::time_point release{};
+};
+
+/**
+ * @brief 작업(Task) 실행기 추상 인터페이스
+ *
+ * 콜백 전달, 비동기 메서드 호출 등을 실행할 스레드/큐를 추상화합니다.
+ * 구현체: WorkStealingScheduler, DeadlineScheduler 등
+ */
+class IExecutor {
+ public:
+  /** @brief 실행 단위 작업 타입 */
+  using Task = std::function<void()>;
+
+  /** @brief 가상 소멸자 */
+  virtual ~IExecutor() = default;
+
+  /**
+   * @brief 작업 제출 (비동기 실행)
+   * @param task 실행할 작업
+   */
+  virtual void post(Task task) = 0;
+
+  /**
+   * @brief 속성 기반 작업 제출
+   *
+   * 우선순위/마감을 지원하지 않는 실행기는 post()와 같습니다.
+   * @param task 실행할 작업
+   * @param attr 우선순위 / 마감 속성
+   */
+  virtual void dispatch(Task task, const DispatchAttr& attr) {
+    (void)attr;
+    post(std::move(task));
+  }
+
+  /**
+   * @brief 이 실행기에 묶인 Strand 통지
+   *
+   * 구독보다 먼저 소멸할 수 있는 실행기는 Strand를 추적해 두었다가
+   * 소멸 전에 닫아야 합니다 (닫힌 Strand는 실행기에 접근하지 않음).
+   * @param strand 새로 묶인 Strand
+   */
+  virtual void attachStrand(const std::shared_ptr<Strand>& strand) {
+    (void)strand;
+  }
+};
+
+#endif  // NEXUM_COM_EXTERNAL_EXECUTOR_IEXECUTOR_H
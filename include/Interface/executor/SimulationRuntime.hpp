@@ -0,0 +1,347 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_EXECUTOR_SIMULATIONRUNTIME_HPP
+#define NEXUM_COM_EXTERNAL_EXECUTOR_SIMULATIONRUNTIME_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "../frame/IFrame.h"
+#include "IExecutor.h"
+
+/**
+ * @brief 가상 시간 기반 단일 스레드 시뮬레이션 런타임
+ *
+ * 콜백 전달, 주기 송신, 타임아웃을 하나의 이벤트 큐에서 (시각, 제출 순)
+ * 순서로 실행합니다. 시간은 다음 이벤트 시각으로 바로 건너뛰므로 실제
+ * 시간보다 훨씬 빠르게 진행되고, 같은 입력이면 항상 같은 순서로 실행됩니다.
+ *
+ * installAsDefault가 true이면 생존 기간 동안 IFrame의 기본 콜백 실행기로
+ * 설치되어, 이후 등록되는 스냅샷 콜백이 스레드 대신 이 큐에서 실행됩니다.
+ * 이 런타임에 묶인 콜백 Strand는 소멸 시 모두 닫히므로, 런타임이 사라진
+ * 뒤의 publish는 해당 콜백을 호출하지 않습니다 (다시 구독해야 함).
+ *
+ * @note 결정성을 위해 run 계열 함수와 이벤트 제출은 한 스레드에서만
+ *       수행해야 합니다 (큐 자체는 다른 스레드의 제출에도 안전).
+ */
+class SimulationRuntime : public IExecutor {
+ public:
+  using Duration = std::chrono::nanoseconds;  ///< 가상 시각 (시작 기준)
+  using EventId = uint64_t;                   ///< 이벤트 ID (0: 무효)
+
+  /**
+   * @brief 생성자
+   * @param installAsDefault IFrame 기본 콜백 실행기로 설치 여부
+   */
+  explicit SimulationRuntime(bool installAsDefault = false);
+
+  /**
+   * @brief 소멸자 (기본 실행기 설치 복구 후 묶인 Strand를 모두 닫음)
+   */
+  ~SimulationRuntime() override;
+
+  SimulationRuntime(const SimulationRuntime&) = delete;
+  SimulationRuntime& operator=(const SimulationRuntime&) = delete;
+
+  /**
+   * @brief 현재 가상 시각에 작업 제출
+   */
+  void post(Task task) override;
+
+  /**
+   * @brief 속성 기반 제출 (가상 시간에서는 제출 순서만 유지)
+   */
+  void dispatch(Task task, const DispatchAttr& attr) override;
+
+  /**
+   * @brief 이 런타임에 묶인 Strand 추적 (소멸 시 닫음)
+   */
+  void attachStrand(const std::shared_ptr<Strand>& strand) override;
+
+  /**
+   * @brief 절대 가상 시각에 작업 예약 (과거 시각이면 현재 시각)
+   * @return 이벤트 ID (cancel용)
+   */
+  EventId scheduleAt(Duration when, Task task);
+
+  /**
+   * @brief 현재 시각 기준 지연 후 작업 예약 (타임아웃 등)
+   * @return 이벤트 ID (cancel용)
+   */
+  EventId scheduleAfter(Duration delay, Task task);
+
+  /**
+   * @brief 주기 작업 예약 (cancel 전까지 반복)
+   * @param period 주기 (0보다 커야 함)
+   * @param task 실행할 작업
+   * @param phase 첫 실행까지의 지연
+   * @return 이벤트 ID (cancel용)
+   * @throws std::invalid_argument period가 0 이하일 때
+   */
+  EventId schedulePeriodic(Duration period, Task task, Duration phase = {});
+
+  /**
+   * @brief 예약된 이벤트 취소 (이미 실행됐거나 없는 ID면 무시)
+   */
+  void cancel(EventId id);
+
+  /**
+   * @brief 현재 가상 시각
+   */
+  Duration now() const;
+
+  /**
+   * @brief 가장 이른 이벤트 하나 실행
+   * @return 실행한 이벤트가 있으면 true
+   */
+  bool step();
+
+  /**
+   * @brief until 시각까지의 이벤트를 모두 실행하고 시각을 until로 이동
+   * @return 실행한 이벤트 수
+   */
+  uint64_t runUntil(Duration until);
+
+  /**
+   * @brief 현재 시각부터 duration 동안 실행
+   * @return 실행한 이벤트 수
+   */
+  uint64_t runFor(Duration duration);
+
+  /**
+   * @brief 큐가 빌 때까지 실행 (주기 작업이 있으면 maxEvents에서 중단)
+   * @return 실행한 이벤트 수
+   */
+  uint64_t runUntilIdle(uint64_t maxEvents = UINT64_MAX);
+
+  /**
+   * @brief 대기 중인 이벤트 수 (취소된 이벤트 제외)
+   */
+  size_t pending() const;
+
+  /**
+   * @brief 지금까지 실행한 이벤트 수
+   */
+  uint64_t executed() const;
+
+ private:
+  struct Event {
+    Duration when;
+    uint64_t seq;  ///< 같은 시각에서의 제출 순서
+    EventId id;
+  };
+
+  struct Later {
+    bool operator()(const Event& a, const Event& b) const {
+      if (a.when != b.when) return a.when > b.when;
+      return a.seq > b.seq;
+    }
+  };
+
+  struct Entry {
+    std::shared_ptr<Task> task;  ///< 주기 작업은 회차 간 상태를 공유
+    Duration period;             ///< 0이면 1회성
+  };
+
+  EventId push(Duration when, Task task, Duration period);
+  bool popDue(Duration limit, std::shared_ptr<Task>& task);
+
+  mutable std::mutex mtx_;
+  std::priority_queue<Event, std::vector<Event>, Later> queue_;
+  std::unordered_map<EventId, Entry> entries_;  ///< 살아 있는 이벤트
+  Duration now_{0};
+  uint64_t nextSeq_ = 0;
+  EventId nextId_ = 1;
+  uint64_t executed_ = 0;
+  bool installed_ = false;
+  IExecutor* previous_ = nullptr;  ///< 설치 전 기본 실행기
+  std::vector<std::weak_ptr<Strand>> strands_;  ///< 묶인 Strand
+};
+
+// ------------------- SimulationRuntime 구현부 -------------------
+
+inline SimulationRuntime::SimulationRuntime(bool installAsDefault)
+    : installed_(installAsDefault) {
+  if (installed_) {
+    previous_ = IFrame::defaultCallbackExecutor();
+    IFrame::setDefaultCallbackExecutor(this);
+  }
+}
+
+inline SimulationRuntime::~SimulationRuntime() {
+  if (installed_ && IFrame::defaultCallbackExecutor() == this)
+    IFrame::setDefaultCallbackExecutor(previous_);
+  std::vector<std::weak_ptr<Strand>> strands;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    strands.swap(strands_);
+  }
+  for (auto& w : strands)
+    if (auto s = w.lock()) s->close();
+}
+
+inline void SimulationRuntime::attachStrand(
+    const std::shared_ptr<Strand>& strand) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  // 해제된 구독의 Strand 정리 (벡터가 계속 커지지 않도록)
+  if (strands_.size() == strands_.capacity())
+    std::erase_if(strands_, [](const auto& w) { return w.expired(); });
+  strands_.push_back(strand);
+}
+
+inline void SimulationRuntime::post(Task task) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  push(now_, std::move(task), Duration{0});
+}
+
+inline void SimulationRuntime::dispatch(Task task, const DispatchAttr& attr) {
+  (void)attr;  // 단일 큐에서는 우선순위 대신 제출 순서로 결정성 유지
+  post(std::move(task));
+}
+
+inline SimulationRuntime::EventId SimulationRuntime::scheduleAt(Duration when,
+                                                                Task task) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return push(std::max(when, now_), std::move(task), Duration{0});
+}
+
+inline SimulationRuntime::EventId SimulationRuntime::scheduleAfter(
+    Duration delay, Task task) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return push(now_ + std::max(delay, Duration{0}), std::move(task),
+              Duration{0});
+}
+
+inline SimulationRuntime::EventId SimulationRuntime::schedulePeriodic(
+    Duration period, Task task, Duration phase) {
+  if (period <= Duration{0})
+    throw std::invalid_argument("SimulationRuntime: period must be positive");
+  std::lock_guard<std::mutex> lock(mtx_);
+  return push(now_ + std::max(phase, Duration{0}), std::move(task), period);
+}
+
+inline void SimulationRuntime::cancel(EventId id) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  entries_.erase(id);  // 큐의 이벤트는 꺼낼 때 건너뜀
+}
+
+inline SimulationRuntime::Duration SimulationRuntime::now() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return now_;
+}
+
+inline SimulationRuntime::EventId SimulationRuntime::push(Duration when,
+                                                          Task task,
+                                                          Duration period) {
+  const EventId id = nextId_++;
+  entries_.emplace(
+      id, Entry{std::make_shared<Task>(std::move(task)), period});
+  queue_.push({when, nextSeq_++, id});
+  return id;
+}
+
+inline bool SimulationRuntime::popDue(Duration limit,
+                                      std::shared_ptr<Task>& task) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  while (!queue_.empty()) {
+    const Event ev = queue_.top();
+    if (ev.when > limit) return false;
+    queue_.pop();
+    auto it = entries_.find(ev.id);
+    if (it == entries_.end()) continue;  // 취소됨
+    now_ = ev.when;
+    if (it->second.period > Duration{0}) {
+      // 주기 작업: 같은 ID로 다음 회차를 먼저 예약 (작업 안에서 cancel 가능)
+      task = it->second.task;
+      queue_.push({ev.when + it->second.period, nextSeq_++, ev.id});
+    } else {
+      task = std::move(it->second.task);
+      entries_.erase(it);
+    }
+    ++executed_;
+    return true;
+  }
+  return false;
+}
+
+inline bool SimulationRuntime::step() {
+  std::shared_ptr<Task> task;
+  if (!popDue(Duration::max(), task)) return false;
+  (*task)();
+  return true;
+}
+
+inline uint64_t SimulationRuntime::runUntil(Duration until) {
+  uint64_t count = 0;
+  std::shared_ptr<Task> task;
+  while (popDue(until, task)) {
+    (*task)();
+    ++count;
+  }
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (until > now_) now_ = until;
+  return count;
+}
+
+inline uint64_t SimulationRuntime::runFor(Duration duration) {
+  return runUntil(now() + duration);
+}
+
+inline uint64_t SimulationRuntime::runUntilIdle(uint64_t maxEvents) {
+  uint64_t count = 0;
+  while (count < maxEvents && step()) ++count;
+  return count;
+}
+
+inline size_t SimulationRuntime::pending() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return entries_.size();
+}
+
+inline uint64_t SimulationRuntime::executed() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return executed_;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_EXECUTOR_SIMULATIONRUNTIME_HPP
@@ -0,0 +1,176 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_EXECUTOR_STRAND_HPP
+#define NEXUM_COM_EXTERNAL_EXECUTOR_STRAND_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "IExecutor.h"
+
+/**
+ * @brief 실행기 위의 직렬 큐 (구독별 순서 보장)
+ *
+ * Strand에 제출된 작업은 제출 순서대로, 한 번에 하나씩만 실행됩니다.
+ * 실행기에는 항상 최대 1개의 작업만 올라가므로 한 구독이 실행기를
+ * 독점하지 않고 다른 구독과 번갈아 실행됩니다.
+ * 실행기는 Strand보다 오래 살아 있어야 합니다.
+ */
+class Strand : public std::enable_shared_from_this<Strand> {
+ public:
+  /**
+   * @brief 생성자
+   * @param executor 작업을 실행할 실행기
+   */
+  explicit Strand(IExecutor& executor) : executor_(executor) {}
+
+  /**
+   * @brief 작업 제출 (닫힌 경우 무시)
+   *
+   * 마감 시간은 실행기에 올라간 시각이 아니라 제출 시각 기준입니다.
+   * @param task 실행할 작업
+   * @param attr 우선순위 / 마감 속성
+   * @throws 실행기 dispatch가 던진 예외 (작업은 큐에 남아 다음 post 때
+   *         함께 스케줄됨)
+   */
+  void post(IExecutor::Task task, DispatchAttr attr = {}) {
+    if (attr.release == std::chrono::steady_clock::time_point{})
+      attr.release = std::chrono::steady_clock::now();
+    DispatchAttr next;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      if (closed_) return;
+      queue_.push_back({std::move(task), attr});
+      if (scheduled_) return;
+      scheduled_ = true;
+      next = queue_.front().attr;
+    }
+    try {
+      schedule(next);
+    } catch (...) {  // finishOne과 같이 다음 post에서 재시도
+      std::lock_guard<std::mutex> lock(mtx_);
+      scheduled_ = false;
+      throw;
+    }
+  }
+
+  /**
+   * @brief 닫기: 대기 작업을 버리고 실행 중인 작업의 종료를 기다림
+   * @note Strand 작업 내부에서 호출하면 대기하지 않습니다.
+   */
+  void close() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    closed_ = true;
+    queue_.clear();
+    if (runningThread_ == std::this_thread::get_id()) return;
+    cv_.wait(lock, [this] { return !running_; });
+  }
+
+  /**
+   * @brief 대기 중인 작업 수
+   */
+  size_t pending() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return queue_.size();
+  }
+
+ private:
+  struct Item {
+    IExecutor::Task task;  ///< 작업
+    DispatchAttr attr;     ///< 디스패치 속성
+  };
+
+  void schedule(const DispatchAttr& attr) {
+    executor_.dispatch([self = shared_from_this()] { self->runOne(); },
+                       attr);
+  }
+
+  void runOne() {
+    IExecutor::Task task;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      if (closed_ || queue_.empty()) {
+        scheduled_ = false;
+        return;
+      }
+      task = std::move(queue_.front().task);
+      queue_.pop_front();
+      running_ = true;
+      runningThread_ = std::this_thread::get_id();
+    }
+    struct Finish {
+      Strand* self;
+      ~Finish() { self->finishOne(); }
+    } finish{this};  // 작업 예외 시에도 상태 복구
+    task();
+  }
+
+  void finishOne() {
+    bool more;
+    DispatchAttr next;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      running_ = false;
+      runningThread_ = std::thread::id();
+      more = !closed_ && !queue_.empty();
+      scheduled_ = more;
+      if (more) next = queue_.front().attr;
+      cv_.notify_all();
+    }
+    if (!more) return;
+    try {
+      schedule(next);
+    } catch (...) {  // 실행기 종료 등: 다음 post에서 재시도
+      std::lock_guard<std::mutex> lock(mtx_);
+      scheduled_ = false;
+    }
+  }
+
+  IExecutor& executor_;            ///< 실행기
+  mutable std::mutex mtx_;         ///< 큐 락
+  std::condition_variable cv_;     ///< 실행 종료 알림
+  std::deque<Item> queue_;         ///< 대기 작업
+  bool scheduled_ = false;         ///< 실행기에 작업이 올라가 있는지
+  bool running_ = false;           ///< 작업 실행 중 여부
+  bool closed_ = false;            ///< 닫힘 여부
+  std::thread::id runningThread_;  ///< 실행 중인 스레드
+};
+
+#endif  // NEXUM_COM_EXTERNAL_EXECUTOR_STRAND_HPP
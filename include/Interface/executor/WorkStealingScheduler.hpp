@@ -0,0 +1,285 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_EXECUTOR_WORKSTEALINGSCHEDULER_HPP
+#define NEXUM_COM_EXTERNAL_EXECUTOR_WORKSTEALINGSCHEDULER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "IExecutor.h"
+
+/**
+ * @brief 워커별 deque와 무작위 훔치기를 사용하는 작업 스케줄러
+ *
+ * - 워커 스레드에서 제출된 작업은 자기 deque 뒤에 쌓고(LIFO로 소비),
+ *   외부 스레드의 제출은 워커들에 라운드로빈으로 분배합니다.
+ * - 할 일이 없는 워커는 무작위로 고른 다른 워커 deque의 앞에서 훔칩니다.
+ * - 구독별 순서 보장은 Strand와 함께 사용합니다.
+ * - stats()로 워커별 실행/훔치기 횟수와 사용률을 조회할 수 있습니다.
+ */
+class WorkStealingScheduler : public IExecutor {
+ public:
+  /**
+   * @brief 워커별 통계
+   */
+  struct WorkerStats {
+    uint64_t executed;   ///< 실행한 작업 수
+    uint64_t steals;     ///< 다른 워커에서 훔친 작업 수
+    uint64_t failed;     ///< 예외로 끝난 작업 수
+    double utilization;  ///< 사용률 (작업 실행 시간 / 경과 시간)
+  };
+
+  /**
+   * @brief 생성자
+   * @param workers 워커 수 (0이면 hardware_concurrency)
+   */
+  explicit WorkStealingScheduler(size_t workers = 0);
+
+  /**
+   * @brief 소멸자 (남은 작업 실행 후 워커 종료)
+   */
+  ~WorkStealingScheduler() override;
+
+  WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+  WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+  /**
+   * @brief 작업 제출
+   * @throws std::runtime_error 종료 이후 제출 시
+   */
+  void post(Task task) override;
+
+  /**
+   * @brief 남은 작업을 모두 실행하고 워커 종료 (중복 호출 가능)
+   * @throws std::logic_error 이 스케줄러의 워커 스레드(작업 안)에서
+   *         호출할 때 (자기 자신을 join할 수 없음)
+   * @note 같은 이유로 워커 스레드에서 소멸시키면 안 됩니다.
+   */
+  void shutdown();
+
+  /**
+   * @brief 워커 수
+   */
+  size_t workerCount() const { return workers_.size(); }
+
+  /**
+   * @brief 워커별 통계 조회
+   */
+  std::vector<WorkerStats> stats() const;
+
+ private:
+  struct alignas(64) Worker {
+    std::mutex mtx;                     ///< deque 락
+    std::deque<Task> deque;             ///< 작업 deque
+    std::thread thread;                 ///< 워커 스레드
+    std::atomic<uint64_t> executed{0};  ///< 실행 수
+    std::atomic<uint64_t> steals{0};    ///< 훔치기 수
+    std::atomic<uint64_t> failed{0};    ///< 예외 수
+    std::atomic<uint64_t> busyNs{0};    ///< 작업 실행 누적 시간
+    uint64_t rng = 0;                   ///< 훔치기 대상 선택용 xorshift
+  };
+
+  void workerLoop(size_t index);
+  bool popLocal(size_t index, Task& task);
+  bool steal(size_t index, Task& task);
+  void push(size_t index, Task task);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<size_t> pending_{0};     ///< 전체 대기 작업 수
+  std::atomic<size_t> sleepers_{0};    ///< 대기 중인 워커 수
+  std::atomic<size_t> nextInject_{0};  ///< 외부 제출 분배 위치
+  std::atomic<bool> stop_{false};      ///< 종료 요청
+  std::mutex idleMtx_;                 ///< 대기 워커 락
+  std::condition_variable idleCv_;     ///< 대기 워커 깨우기
+  /** @brief 통계 기준 시각 */
+  std::chrono::steady_clock::time_point start_;
+
+  inline static thread_local WorkStealingScheduler* tlsOwner_ = nullptr;
+  inline static thread_local size_t tlsIndex_ = 0;
+};
+
+// ------------------- WorkStealingScheduler 구현부 -------------------
+
+inline WorkStealingScheduler::WorkStealingScheduler(size_t workers)
+    : start_(std::chrono::steady_clock::now()) {
+  if (workers == 0) workers = std::max(1u, std::thread::hardware_concurrency());
+  workers_.reserve(workers);
+  for (size_t i = 0; i < workers; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+    workers_.back()->rng = 0x9E3779B97F4A7C15ull * (i + 1);
+  }
+  for (size_t i = 0; i < workers; ++i)
+    workers_[i]->thread = std::thread([this, i] { workerLoop(i); });
+}
+
+inline WorkStealingScheduler::~WorkStealingScheduler() { shutdown(); }
+
+inline void WorkStealingScheduler::shutdown() {
+  if (tlsOwner_ == this)
+    throw std::logic_error(
+        "WorkStealingScheduler: shutdown from a worker thread");
+  {
+    std::lock_guard<std::mutex> lock(idleMtx_);
+    stop_ = true;
+  }
+  idleCv_.notify_all();
+  for (auto& w : workers_)
+    if (w->thread.joinable()) w->thread.join();
+}
+
+inline void WorkStealingScheduler::post(Task task) {
+  // 대기 수를 먼저 올린 뒤 stop_을 확인: 워커는 stop_ && pending_ == 0일
+  // 때만 끝나므로, 여기서 stop_을 못 봤다면 워커가 이 작업을 기다림
+  pending_.fetch_add(1);
+  if (stop_.load()) {
+    pending_.fetch_sub(1);
+    throw std::runtime_error("WorkStealingScheduler: post after shutdown");
+  }
+  const size_t index =
+      tlsOwner_ == this
+          ? tlsIndex_
+          : nextInject_.fetch_add(1, std::memory_order_relaxed) %
+                workers_.size();
+  try {
+    push(index, std::move(task));
+  } catch (...) {
+    pending_.fetch_sub(1);  // deque 할당 실패: 세지 않은 것으로 되돌림
+    throw;
+  }
+}
+
+/**
+ * @brief deque에 작업 추가 후 대기 워커 깨우기 (pending_은 post에서 증가)
+ */
+inline void WorkStealingScheduler::push(size_t index, Task task) {
+  {
+    std::lock_guard<std::mutex> lock(workers_[index]->mtx);
+    workers_[index]->deque.push_back(std::move(task));
+  }
+  if (sleepers_.load() > 0) {
+    { std::lock_guard<std::mutex> lock(idleMtx_); }
+    idleCv_.notify_one();
+  }
+}
+
+inline bool WorkStealingScheduler::popLocal(size_t index, Task& task) {
+  Worker& w = *workers_[index];
+  std::lock_guard<std::mutex> lock(w.mtx);
+  if (w.deque.empty()) return false;
+  task = std::move(w.deque.back());
+  w.deque.pop_back();
+  return true;
+}
+
+inline bool WorkStealingScheduler::steal(size_t index, Task& task) {
+  const size_t n = workers_.size();
+  if (n < 2) return false;
+  Worker& self = *workers_[index];
+  self.rng ^= self.rng << 13;
+  self.rng ^= self.rng >> 7;
+  self.rng ^= self.rng << 17;
+  const size_t first = self.rng % n;
+  for (size_t k = 0; k < n; ++k) {
+    const size_t victim = (first + k) % n;
+    if (victim == index) continue;
+    Worker& v = *workers_[victim];
+    std::lock_guard<std::mutex> lock(v.mtx);
+    if (v.deque.empty()) continue;
+    task = std::move(v.deque.front());
+    v.deque.pop_front();
+    self.steals.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+inline void WorkStealingScheduler::workerLoop(size_t index) {
+  tlsOwner_ = this;
+  tlsIndex_ = index;
+  Worker& self = *workers_[index];
+  for (;;) {
+    Task task;
+    if (popLocal(index, task) || steal(index, task)) {
+      pending_.fetch_sub(1);
+      const auto t0 = std::chrono::steady_clock::now();
+      try {
+        task();
+      } catch (...) {
+        self.failed.fetch_add(1, std::memory_order_relaxed);
+      }
+      const auto t1 = std::chrono::steady_clock::now();
+      self.busyNs.fetch_add(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+              .count(),
+          std::memory_order_relaxed);
+      self.executed.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(idleMtx_);
+    if (stop_ && pending_.load() == 0) break;
+    sleepers_.fetch_add(1);
+    idleCv_.wait(lock, [this] { return pending_.load() > 0 || stop_; });
+    sleepers_.fetch_sub(1);
+  }
+  tlsOwner_ = nullptr;
+}
+
+inline std::vector<WorkStealingScheduler::WorkerStats>
+WorkStealingScheduler::stats() const {
+  const double elapsed =
+      std::chrono::duration<double, std::nano>(
+          std::chrono::steady_clock::now() - start_)
+          .count();
+  std::vector<WorkerStats> out;
+  out.reserve(workers_.size());
+  for (const auto& w : workers_) {
+    const double busy = static_cast<double>(w->busyNs.load());
+    out.push_back({w->executed.load(), w->steals.load(), w->failed.load(),
+                   elapsed > 0 ? busy / elapsed : 0.0});
+  }
+  return out;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_EXECUTOR_WORKSTEALINGSCHEDULER_HPP
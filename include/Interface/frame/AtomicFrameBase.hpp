@@ -0,0 +1,427 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_ATOMICFRAMEBASE_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_ATOMICFRAMEBASE_HPP
+
+#include <any>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../bus_Factory/AutoRegister.hpp"
+#include "../frame/FrameBase.hpp"
+#include "../frame/IFrame.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define NEXUM_COM_EXTERNAL_ATOMIC_CX16 1
+#endif
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "AtomicFrameBase requires a lock-free 64-bit atomic");
+
+#ifdef NEXUM_COM_EXTERNAL_ATOMIC_CX16
+/**
+ * @brief cmpxchg16b 기반 16바이트 원자 슬롯 (x86-64 전용)
+ *
+ * std::atomic<16바이트>는 GCC에서 libatomic 호출로 내려가고
+ * is_always_lock_free가 false이므로 lock cmpxchg16b를 직접 사용합니다.
+ * lock 접두어는 완전 배리어이므로 memory_order 인자는 무시합니다.
+ *
+ * load는 캐시 라인에 쓰지 않도록 시작/완료 카운터로 검증하는 seqlock
+ * 읽기(8바이트 원자 load 2회)를 먼저 시도합니다. 쓰기는 CAS 전후로
+ * 카운터를 올리므로 락은 없지만 RMW 2회가 추가됩니다. 쓰기가 계속되어
+ * kOptimisticReads회 모두 실패하면 cmpxchg16b 읽기로 진행을 보장합니다.
+ */
+class AtomicSlot16 {
+ public:
+  /** @brief 16바이트 슬롯 값 */
+  struct alignas(16) Value {
+    uint64_t lo;
+    uint64_t hi;
+  };
+
+  /** @brief cmpxchg16b로 넘어가기 전 검증 읽기 시도 횟수 */
+  static constexpr int kOptimisticReads = 64;
+
+  explicit AtomicSlot16(Value v) : v_(v) {}
+  AtomicSlot16(const AtomicSlot16&) = delete;
+  AtomicSlot16& operator=(const AtomicSlot16&) = delete;
+
+  Value load(std::memory_order = std::memory_order_seq_cst) const {
+    for (int i = 0; i < kOptimisticReads; ++i) {
+      const uint64_t done = done_.load(std::memory_order_acquire);
+      if (begun_.load(std::memory_order_acquire) != done) continue;
+      const Value v{half(v_.lo).load(std::memory_order_relaxed),
+                    half(v_.hi).load(std::memory_order_relaxed)};
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (begun_.load(std::memory_order_relaxed) == done) return v;
+    }
+    Value cur{0, 0};
+    cas(cur, cur);  // 같으면 같은 값 기록, 다르면 cur에 현재 값
+    return cur;
+  }
+
+  void store(Value desired, std::memory_order = std::memory_order_seq_cst) {
+    begun_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Value cur{half(v_.lo).load(std::memory_order_relaxed),
+              half(v_.hi).load(std::memory_order_relaxed)};  // 첫 추측
+    while (!cas(cur, desired)) {
+    }
+    done_.fetch_add(1, std::memory_order_release);
+  }
+
+  bool compare_exchange_weak(Value& expected, Value desired,
+                             std::memory_order, std::memory_order) {
+    begun_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    const bool ok = cas(expected, desired);
+    done_.fetch_add(1, std::memory_order_release);
+    return ok;
+  }
+
+ private:
+  static std::atomic_ref<uint64_t> half(uint64_t& w) {
+    return std::atomic_ref<uint64_t>(w);
+  }
+
+  bool cas(Value& expected, Value desired) const {
+    bool ok;
+    __asm__ __volatile__("lock cmpxchg16b %1"
+                         : "=@ccz"(ok), "+m"(v_), "+a"(expected.lo),
+                           "+d"(expected.hi)
+                         : "b"(desired.lo), "c"(desired.hi)
+                         : "memory");
+    return ok;
+  }
+
+  std::atomic<uint64_t> begun_{0};  ///< 시작된 쓰기 수
+  std::atomic<uint64_t> done_{0};   ///< 끝난 쓰기 수
+  mutable Value v_;
+};
+
+/** @brief AtomicFrameBase가 받는 최대 데이터 크기 */
+inline constexpr size_t kAtomicFrameMaxSize = 16;
+#else
+inline constexpr size_t kAtomicFrameMaxSize = 8;
+#endif
+
+/**
+ * @brief 작은 데이터 구조체용 락 프리 프레임 템플릿 클래스
+ *
+ * FrameBase와 달리 data_를 shared_mutex 대신 원자 슬롯에 보관합니다.
+ * - sizeof(DataT) <= 8 : std::atomic<uint64_t> (락 프리 정적 확인)
+ * - sizeof(DataT) <= 16: x86-64(GCC/Clang)에서만 cmpxchg16b 슬롯
+ *   (AtomicSlot16). 그 외 플랫폼에서 9~16바이트 데이터는 제약을
+ *   만족하지 않으므로 FrameBase를 사용해야 합니다. 읽기는 검증 읽기라
+ *   리더끼리 캐시 라인을 두고 경합하지 않지만 쓰기는 8바이트보다 무겁습니다.
+ *
+ * 읽기/쓰기는 원자 load/store 1회, 신호 단위 갱신(read-modify-write)은
+ * CAS 루프로 처리하므로 양쪽 모두 락이 없습니다. 신호 등록은
+ * registerSignal(name, &DataT::member) 형태로 합니다.
+ * version()은 store/update가 아니라 발행(notifyCallbacks)마다 증가합니다.
+ *
+ * @tparam DataT 신호 데이터 구조체 타입 (kAtomicFrameMaxSize 이하)
+ * @tparam Derived CRTP 파생 타입
+ */
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+class AtomicFrameBase : public AutoRegister<Derived, IFrame> {
+ public:
+  using Data = DataT;
+
+  /**
+   * @brief 생성자 (데이터 0 초기화 + instanceName)
+   */
+  explicit AtomicFrameBase(const std::string& instanceName);
+
+  /**
+   * @brief 데이터 원자적 읽기 (복사본)
+   * @return Data
+   */
+  Data load() const;
+
+  /**
+   * @brief 데이터 원자적 쓰기
+   * @param d 저장할 데이터
+   */
+  void store(const Data& d);
+
+  /**
+   * @brief 데이터 원자적 갱신 (CAS 루프)
+   * @param fn 데이터 수정 함수 (경합 시 재호출될 수 있음)
+   * @return 갱신된 데이터
+   */
+  template <typename Fn>
+  Data update(Fn&& fn);
+
+  /**
+   * @brief 원시 데이터 접근 (복사본 기반)
+   * @note writeRawData의 func는 CAS 경합 시 재호출될 수 있습니다.
+   */
+  void readRawData(
+      std::function<void(const char*, size_t)> func) const override;
+  void writeRawData(std::function<void(char*, size_t)> func) override;
+
+  /**
+   * @brief 데이터 크기 반환
+   * @return 크기 (바이트)
+   */
+  size_t size() const override;
+
+  std::vector<uint8_t> serialize() const override;
+  bool deserializeWithPublish(const std::vector<uint8_t>& raw) override;
+  void deserialize(const std::vector<uint8_t>& raw) override;
+  size_t serializedSize() const override;
+  size_t serializeInto(std::span<std::byte> out) const override;
+  void deserializeFrom(std::span<const std::byte> raw) override;
+  bool deserializeFromWithPublish(std::span<const std::byte> raw) override;
+
+  /**
+   * @brief 프레임 인스턴스 이름 반환
+   */
+  std::string id() const override;
+  std::string_view idView() const noexcept override { return instanceName_; }
+
+ protected:
+  /**
+   * @brief 신호 등록 (원자 슬롯 기반 Get/Set)
+   * @tparam Field 멤버 변수 타입
+   * @param name 신호명
+   * @param member 멤버 포인터
+   */
+  template <typename Field>
+  void registerSignal(const std::string& name, Field DataT::* member);
+
+  bool copyRawUnlocked(std::span<std::byte> out) const override {
+    if (out.size() < sizeof(DataT)) return false;
+    const Data d = load();
+    std::memcpy(out.data(), &d, sizeof(DataT));
+    return true;
+  }
+
+ private:
+  static constexpr bool kWide = sizeof(DataT) > 8;
+
+#ifdef NEXUM_COM_EXTERNAL_ATOMIC_CX16
+  using Slot = std::conditional_t<kWide, AtomicSlot16::Value, uint64_t>;
+  using SlotAtomic =
+      std::conditional_t<kWide, AtomicSlot16, std::atomic<uint64_t>>;
+#else
+  using Slot = uint64_t;
+  using SlotAtomic = std::atomic<uint64_t>;
+#endif
+
+  static Slot pack(const Data& d);
+  static Data unpack(const Slot& s);
+
+  SlotAtomic slot_;           ///< 원자 데이터 슬롯
+  std::string instanceName_;  ///< 인스턴스 이름
+};
+
+// ----- AtomicFrameBase<DataT,Derived> 구현 -----
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline AtomicFrameBase<DataT, Derived>::AtomicFrameBase(
+    const std::string& instanceName)
+    : slot_(Slot{}), instanceName_(instanceName) {
+  this->versionOnPublish_ = true;  // store/update는 원자 연산 1회만 수행
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline typename AtomicFrameBase<DataT, Derived>::Slot
+AtomicFrameBase<DataT, Derived>::pack(const Data& d) {
+  Slot s{};  // 남는 바이트는 항상 0 (CAS 비교 안정성)
+  std::memcpy(&s, &d, sizeof(DataT));
+  return s;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline DataT AtomicFrameBase<DataT, Derived>::unpack(const Slot& s) {
+  Data d;
+  std::memcpy(&d, &s, sizeof(DataT));
+  return d;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline DataT AtomicFrameBase<DataT, Derived>::load() const {
+  return unpack(slot_.load(std::memory_order_acquire));
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline void AtomicFrameBase<DataT, Derived>::store(const Data& d) {
+  slot_.store(pack(d), std::memory_order_release);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+template <typename Fn>
+inline DataT AtomicFrameBase<DataT, Derived>::update(Fn&& fn) {
+  Slot expected = slot_.load(std::memory_order_acquire);
+  for (;;) {
+    Data d = unpack(expected);
+    fn(d);
+    if (slot_.compare_exchange_weak(expected, pack(d),
+                                    std::memory_order_acq_rel,
+                                    std::memory_order_acquire))
+      return d;
+  }
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+template <typename Field>
+inline void AtomicFrameBase<DataT, Derived>::registerSignal(
+    const std::string& name, Field DataT::* member) {
+  Data probe;  // 오프셋 계산용 (값은 사용하지 않음)
+  this->registerSignalAccessor(
+      name, SignalDescriptor::of(member, &probe),
+      [this, member]() -> std::any { return load().*member; },
+      [this, member](const std::any& v) {
+        const Field value = std::any_cast<Field>(v);
+        update([&](Data& d) { d.*member = value; });
+      });
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline void AtomicFrameBase<DataT, Derived>::readRawData(
+    std::function<void(const char*, size_t)> func) const {
+  const Data d = load();
+  func(reinterpret_cast<const char*>(&d), sizeof(DataT));
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline void AtomicFrameBase<DataT, Derived>::writeRawData(
+    std::function<void(char*, size_t)> func) {
+  update([&](Data& d) { func(reinterpret_cast<char*>(&d), sizeof(DataT)); });
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline size_t AtomicFrameBase<DataT, Derived>::size() const {
+  return sizeof(DataT);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline std::vector<uint8_t> AtomicFrameBase<DataT, Derived>::serialize()
+    const {
+  const Data d = load();
+  std::vector<uint8_t> buf(sizeof(DataT));
+  std::memcpy(buf.data(), &d, sizeof(DataT));
+  return buf;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline void AtomicFrameBase<DataT, Derived>::deserialize(
+    const std::vector<uint8_t>& raw) {
+  AtomicFrameBase::deserializeFrom(std::as_bytes(std::span(raw)));
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline bool AtomicFrameBase<DataT, Derived>::deserializeWithPublish(
+    const std::vector<uint8_t>& raw) {
+  return AtomicFrameBase::deserializeFromWithPublish(
+      std::as_bytes(std::span(raw)));
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline size_t AtomicFrameBase<DataT, Derived>::serializedSize() const {
+  return sizeof(DataT);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline size_t AtomicFrameBase<DataT, Derived>::serializeInto(
+    std::span<std::byte> out) const {
+  if (out.size() < sizeof(DataT))
+    throw std::runtime_error(
+        "AtomicFrameBase: serializeInto buffer too small: got " +
+        std::to_string(out.size()) + ", need " +
+        std::to_string(sizeof(DataT)));
+  const Data d = load();
+  std::memcpy(out.data(), &d, sizeof(DataT));
+  return sizeof(DataT);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline void AtomicFrameBase<DataT, Derived>::deserializeFrom(
+    std::span<const std::byte> raw) {
+  if (raw.size() != sizeof(DataT))
+    throw std::runtime_error(
+        "AtomicFrameBase: deserialize size mismatch: got " +
+        std::to_string(raw.size()) + ", expected " +
+        std::to_string(sizeof(DataT)));
+  Data d;
+  std::memcpy(&d, raw.data(), sizeof(DataT));
+  store(d);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline bool AtomicFrameBase<DataT, Derived>::deserializeFromWithPublish(
+    std::span<const std::byte> raw) {
+  AtomicFrameBase::deserializeFrom(raw);
+  this->notifyCallbacks();
+  return true;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT> && (sizeof(DataT) <= kAtomicFrameMaxSize)
+inline std::string AtomicFrameBase<DataT, Derived>::id() const {
+  return instanceName_;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_ATOMICFRAMEBASE_HPP
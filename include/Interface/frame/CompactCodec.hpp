@@ -0,0 +1,499 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_COMPACTCODEC_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_COMPACTCODEC_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SignalTable.hpp"
+
+/**
+ * @brief 신호 디스크립터 기반 압축 와이어 포맷 코덱
+ *
+ * 데이터 구조체를 최대 8바이트 원소로 나누고, 기본값과 다른 원소만
+ * 기록합니다. 정수 신호는 varint(부호 있는 타입은 zigzag), 실수/1바이트
+ * 신호와 신호가 아닌 바이트(패딩 등)는 원본 바이트로 기록하며, 큰 바이트
+ * 영역은 8바이트 조각마다 따로 판정합니다.
+ *
+ * | 오프셋 | 내용                                          |
+ * |--------|-----------------------------------------------|
+ * | 0      | 태그 (0xB0: 비트맵, 0xB1: 사전)               |
+ * | 1      | 스키마 지문 (uint32 LE, 원소 구성 해시)       |
+ * | 5      | 비트맵: ceil(원소 수/8) 바이트 + 값 목록      |
+ * |        | 사전: varint 개수 + (varint id 증분, 값) 목록 |
+ *
+ * 인코더는 두 방식 중 짧은 쪽을 고릅니다 (드문드문한 큰 프레임은 사전).
+ * 디코더는 지문이 다르면 예외를 던지므로 레이아웃이 다른 상대의
+ * 페이로드를 잘못 해석하지 않습니다. 호스트는 little endian이어야
+ * 합니다.
+ */
+class CompactCodec {
+ public:
+  static constexpr uint8_t kTagBitmap = 0xB0;      ///< 비트맵 방식 태그
+  static constexpr uint8_t kTagDictionary = 0xB1;  ///< 사전 방식 태그
+  static constexpr size_t kHeaderSize = 5;         ///< 태그 + 지문
+
+  /**
+   * @brief 코덱 구성
+   * @param signals 신호 엔트리 (겹치는 신호는 앞선 것만 사용)
+   * @param defaults 기본값 데이터 (구조체 전체)
+   */
+  CompactCodec(std::span<const SignalTable::Entry> signals,
+               std::span<const std::byte> defaults)
+      : dataSize_(defaults.size()),
+        defaults_(defaults.begin(), defaults.end()) {
+    std::vector<SignalDescriptor> fields;
+    for (const auto& e : signals) fields.push_back(e.desc);
+    std::stable_sort(fields.begin(), fields.end(),
+                     [](const SignalDescriptor& a, const SignalDescriptor& b) {
+                       return a.offset < b.offset;
+                     });
+    size_t pos = 0;
+    for (const auto& f : fields) {
+      if (f.offset < pos || f.offset + f.size > dataSize_) continue;
+      addRaw(pos, f.offset - pos);  // 신호 사이 바이트
+      addField(f);
+      pos = f.offset + f.size;
+    }
+    addRaw(pos, dataSize_ - pos);
+    computeFingerprint();
+  }
+
+  /**
+   * @brief 원소 수
+   */
+  size_t elementCount() const { return elems_.size(); }
+
+  /**
+   * @brief 스키마 지문
+   */
+  uint32_t fingerprint() const { return fingerprint_; }
+
+  /**
+   * @brief 인코딩 결과의 최대 크기
+   */
+  size_t maxEncodedSize() const { return maxEncoded_; }
+
+  /**
+   * @brief 인코딩
+   * @param data 구조체 데이터
+   * @param out 출력 버퍼 (maxEncodedSize() 이상)
+   * @return 기록한 바이트 수
+   * @throws std::runtime_error 크기가 맞지 않는 경우
+   */
+  size_t encode(std::span<const std::byte> data,
+                std::span<std::byte> out) const {
+    if (data.size() != dataSize_ || out.size() < maxEncoded_)
+      throw std::runtime_error(
+          "CompactCodec: encode size mismatch: data " +
+          std::to_string(data.size()) + ", buffer " +
+          std::to_string(out.size()) + " (need " +
+          std::to_string(maxEncoded_) + ")");
+    const std::byte* in = data.data();
+    std::byte* o = out.data();
+    const Element* el = elems_.data();
+    const size_t n = elems_.size();
+    const size_t bitmapBytes = (n + 7) / 8;
+
+    // 1차: 비트맵을 출력 위치에 직접 구성
+    std::byte* bitmap = o + kHeaderSize;
+    std::memset(bitmap, 0, bitmapBytes);
+    const std::byte* def = defaults_.data();
+    for (const auto& r : runs_) {  // 연속 8바이트 조각: 8워드씩 XOR-OR 검사
+      const std::byte* src = in + r.offset;
+      const std::byte* ref = def + r.offset;
+      for (size_t k = 0; k < r.count; k += 8) {
+        const size_t m = std::min<size_t>(8, r.count - k);
+        uint64_t diff[8];
+        uint64_t any = 0;
+        for (size_t j = 0; j < m; ++j) {
+          diff[j] = load8(src + (k + j) * 8) ^ load8(ref + (k + j) * 8);
+          any |= diff[j];
+        }
+        if (!any) continue;
+        for (size_t j = 0; j < m; ++j)
+          if (diff[j]) setBit(bitmap, r.first + k + j);
+      }
+    }
+    for (uint32_t i : scattered_)
+      if (load(in + el[i].offset, el[i].size) != el[i].def) setBit(bitmap, i);
+
+    size_t present = 0;
+    size_t dictIdBytes = 0;
+    size_t prev = 0;
+    for (size_t base = 0; base < n; base += 64) {
+      uint64_t w = loadBitmapWord(bitmap + base / 8,
+                                  (std::min(n, base + 64) - base + 7) / 8);
+      present += static_cast<size_t>(std::popcount(w));
+      for (; w; w &= w - 1) {
+        size_t i = base + static_cast<size_t>(std::countr_zero(w));
+        dictIdBytes += varintSize(i - prev);
+        prev = i + 1;
+      }
+    }
+    writeHeader(o, kTagBitmap);
+
+    // 2차: 설정된 비트만 순회하며 값 기록
+    const size_t countBytes = varintSize(present);
+    const bool dictionary = countBytes + dictIdBytes < bitmapBytes;
+    std::byte* p = bitmap + bitmapBytes + (dictionary ? countBytes : 0);
+    std::byte* entries = p;
+    prev = 0;
+    for (size_t base = 0; base < n; base += 64) {
+      uint64_t w = loadBitmapWord(bitmap + base / 8,
+                                  (std::min(n, base + 64) - base + 7) / 8);
+      for (; w; w &= w - 1) {
+        size_t i = base + static_cast<size_t>(std::countr_zero(w));
+        if (dictionary) {
+          p = putVarint(p, i - prev);
+          prev = i + 1;
+        }
+        p = putValue(p, in, el[i]);
+      }
+    }
+    if (!dictionary) return static_cast<size_t>(p - o);
+
+    // 사전: 비트맵 뒤에 기록한 항목을 개수 뒤로 당김
+    // (사전이 더 짧을 때만 선택되므로 최대 크기를 넘지 않음)
+    o[0] = std::byte{kTagDictionary};
+    std::byte* q = putVarint(o + kHeaderSize, present);
+    std::memmove(q, entries, static_cast<size_t>(p - entries));
+    return static_cast<size_t>(q - o) + static_cast<size_t>(p - entries);
+  }
+
+  /**
+   * @brief 디코딩 (기본값에서 시작해 기록된 원소만 덮어씀)
+   * @param in 인코딩 데이터
+   * @param data 구조체 데이터 (출력)
+   * @throws std::runtime_error 형식 오류/지문 불일치/잘림
+   *         (이때 data 내용은 부분적으로 바뀌어 있을 수 있음)
+   */
+  void decode(std::span<const std::byte> in, std::span<std::byte> data) const {
+    if (data.size() != dataSize_)
+      throw std::runtime_error("CompactCodec: decode size mismatch: got " +
+                               std::to_string(data.size()) + ", expected " +
+                               std::to_string(dataSize_));
+    if (in.size() < kHeaderSize) fail("truncated header");
+    const std::byte* p = in.data();
+    const std::byte* end = p + in.size();
+    uint8_t tag = static_cast<uint8_t>(p[0]);
+    uint32_t fp;
+    std::memcpy(&fp, p + 1, 4);
+    if (fp != fingerprint_) fail("schema fingerprint mismatch");
+    p += kHeaderSize;
+
+    std::byte* out = data.data();
+    std::memcpy(out, defaults_.data(), dataSize_);
+    const Element* el = elems_.data();
+    const size_t n = elems_.size();
+    if (tag == kTagBitmap) {
+      const size_t bitmapBytes = (n + 7) / 8;
+      if (static_cast<size_t>(end - p) < bitmapBytes) fail("truncated bitmap");
+      const std::byte* bitmap = p;
+      p += bitmapBytes;
+      for (size_t base = 0; base < n; base += 64) {
+        const size_t bytes = (std::min(n, base + 64) - base + 7) / 8;
+        uint64_t w = loadBitmapWord(bitmap + base / 8, bytes);
+        if (base + 64 > n && (w >> (n - base)) != 0) fail("stray bitmap bits");
+        for (; w; w &= w - 1)
+          p = getValue(p, end, out,
+                       el[base + static_cast<size_t>(std::countr_zero(w))]);
+      }
+    } else if (tag == kTagDictionary) {
+      uint64_t count;
+      p = getVarint(p, end, count);
+      size_t i = 0;
+      for (uint64_t k = 0; k < count; ++k) {
+        uint64_t delta;
+        p = getVarint(p, end, delta);
+        if (delta >= n - i) fail("element id out of range");
+        i += delta;
+        p = getValue(p, end, out, el[i]);
+        ++i;
+      }
+    } else {
+      fail("unknown tag");
+    }
+    if (p != end) fail("trailing bytes");
+  }
+
+ private:
+  enum class Kind : uint8_t {
+    UInt,  ///< 부호 없는 varint
+    SInt,  ///< zigzag varint
+    Raw,   ///< 원본 바이트
+  };
+
+  /**
+   * @brief 인코딩 원소 (최대 8바이트)
+   */
+  struct Element {
+    uint64_t def;     ///< 기본값 (비교용, 하위 size 바이트)
+    uint32_t offset;  ///< 구조체 내 오프셋
+    uint8_t size;     ///< 크기 (1..8)
+    Kind kind;        ///< 인코딩 종류
+  };
+
+  /**
+   * @brief 메모리상 연속된 8바이트 원본 조각 구간 (원소 번호도 연속)
+   */
+  struct Run {
+    uint32_t first;   ///< 첫 원소 번호
+    uint32_t count;   ///< 원소 수
+    uint32_t offset;  ///< 첫 원소 오프셋
+  };
+
+  static constexpr size_t kChunk = 8;  ///< 원본 바이트 조각 크기
+
+  [[noreturn]] static void fail(const char* what) {
+    throw std::runtime_error(std::string("CompactCodec: ") + what);
+  }
+
+  void addElement(size_t offset, size_t size, Kind kind) {
+    elems_.push_back({load(defaults_.data() + offset, size),
+                      static_cast<uint32_t>(offset),
+                      static_cast<uint8_t>(size), kind});
+    const auto index = static_cast<uint32_t>(elems_.size() - 1);
+    if (kind != Kind::Raw || size != kChunk) {
+      scattered_.push_back(index);
+    } else if (!runs_.empty() &&
+               runs_.back().first + runs_.back().count == index &&
+               runs_.back().offset + runs_.back().count * kChunk == offset) {
+      ++runs_.back().count;
+    } else {
+      runs_.push_back({index, 1, static_cast<uint32_t>(offset)});
+    }
+  }
+
+  void addRaw(size_t offset, size_t len) {
+    for (size_t i = 0; i < len; i += kChunk)
+      addElement(offset + i, std::min(kChunk, len - i), Kind::Raw);
+  }
+
+  void addField(const SignalDescriptor& f) {
+    const size_t elem = f.size / f.count;
+    Kind kind;
+    switch (f.type) {
+      case SignalType::Int16:
+      case SignalType::Int32:
+      case SignalType::Int64:
+        kind = Kind::SInt;
+        break;
+      case SignalType::UInt16:
+      case SignalType::UInt32:
+      case SignalType::UInt64:
+        kind = Kind::UInt;
+        break;
+      default:  // bool, 1바이트 정수, 실수, 구조체
+        addRaw(f.offset, f.size);
+        return;
+    }
+    for (size_t i = 0; i < f.count; ++i)
+      addElement(f.offset + i * elem, elem, kind);
+  }
+
+  // 원소 구성(오프셋/크기/종류)과 전체 크기에 대한 FNV-1a
+  void computeFingerprint() {
+    uint32_t h = 2166136261u;
+    auto mix = [&h](uint64_t v) {
+      for (int i = 0; i < 8; ++i) {
+        h ^= static_cast<uint8_t>(v >> (8 * i));
+        h *= 16777619u;
+      }
+    };
+    mix(dataSize_);
+    maxEncoded_ = kHeaderSize + (elems_.size() + 7) / 8;
+    for (const auto& e : elems_) {
+      mix(uint64_t{e.offset} << 16 | uint64_t{e.size} << 8 |
+          static_cast<uint8_t>(e.kind));
+      maxEncoded_ += e.kind == Kind::Raw ? e.size : (e.size * 8 + 6) / 7;
+    }
+    fingerprint_ = h;
+  }
+
+  static uint64_t load8(const std::byte* p) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+  }
+
+  static uint64_t load(const std::byte* p, size_t size) {
+    uint64_t v = 0;
+    switch (size) {
+      case 8:
+        std::memcpy(&v, p, 8);
+        break;
+      case 4: {
+        uint32_t x;
+        std::memcpy(&x, p, 4);
+        v = x;
+        break;
+      }
+      case 2: {
+        uint16_t x;
+        std::memcpy(&x, p, 2);
+        v = x;
+        break;
+      }
+      case 1:
+        v = static_cast<uint8_t>(*p);
+        break;
+      default:
+        std::memcpy(&v, p, size);
+        break;
+    }
+    return v;
+  }
+
+  static void setBit(std::byte* bitmap, size_t i) {
+    bitmap[i / 8] |= std::byte(1u << (i % 8));
+  }
+
+  static uint64_t loadBitmapWord(const std::byte* p, size_t bytes) {
+    uint64_t w = 0;
+    if (bytes == 8) {
+      std::memcpy(&w, p, 8);
+      return w;
+    }
+    for (size_t b = 0; b < bytes; ++b)
+      w |= uint64_t{static_cast<uint8_t>(p[b])} << (8 * b);
+    return w;
+  }
+
+  static size_t varintSize(uint64_t v) {
+    return static_cast<size_t>((std::bit_width(v | 1) + 6) / 7);
+  }
+
+  static std::byte* putVarint(std::byte* p, uint64_t v) {
+    while (v >= 0x80) {
+      *p++ = std::byte(static_cast<uint8_t>(v) | 0x80);
+      v >>= 7;
+    }
+    *p++ = std::byte(static_cast<uint8_t>(v));
+    return p;
+  }
+
+  static const std::byte* getVarint(const std::byte* p, const std::byte* end,
+                                    uint64_t& v) {
+    v = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+      if (p == end) fail("truncated varint");
+      uint8_t b = static_cast<uint8_t>(*p++);
+      v |= uint64_t{b & 0x7Fu} << shift;
+      if (!(b & 0x80)) return p;
+    }
+    fail("varint too long");
+  }
+
+  static std::byte* putValue(std::byte* p, const std::byte* in,
+                             const Element& e) {
+    const std::byte* src = in + e.offset;
+    switch (e.kind) {
+      case Kind::Raw:
+        copySmall(p, src, e.size);
+        return p + e.size;
+      case Kind::UInt:
+        return putVarint(p, load(src, e.size));
+      case Kind::SInt: {
+        const unsigned bits = e.size * 8u;
+        int64_t s = static_cast<int64_t>(load(src, e.size) << (64 - bits)) >>
+                    (64 - bits);
+        return putVarint(p, (static_cast<uint64_t>(s) << 1) ^
+                                static_cast<uint64_t>(s >> 63));
+      }
+    }
+    return p;
+  }
+
+  static const std::byte* getValue(const std::byte* p, const std::byte* end,
+                                   std::byte* out, const Element& e) {
+    std::byte* dst = out + e.offset;
+    if (e.kind == Kind::Raw) {
+      if (static_cast<size_t>(end - p) < e.size) fail("truncated value");
+      copySmall(dst, p, e.size);
+      return p + e.size;
+    }
+    uint64_t v;
+    p = getVarint(p, end, v);
+    if (e.kind == Kind::SInt) v = (v >> 1) ^ (~(v & 1) + 1);  // zigzag 복원
+    copySmall(dst, reinterpret_cast<const std::byte*>(&v), e.size);
+    return p;
+  }
+
+  // 원소 크기 복사 (자주 쓰는 크기는 고정 길이 memcpy로)
+  static void copySmall(std::byte* dst, const std::byte* src, size_t size) {
+    switch (size) {
+      case 8:
+        std::memcpy(dst, src, 8);
+        break;
+      case 4:
+        std::memcpy(dst, src, 4);
+        break;
+      case 2:
+        std::memcpy(dst, src, 2);
+        break;
+      case 1:
+        *dst = *src;
+        break;
+      default:
+        std::memcpy(dst, src, size);
+        break;
+    }
+  }
+
+  void writeHeader(std::byte* o, uint8_t tag) const {
+    o[0] = std::byte{tag};
+    std::memcpy(o + 1, &fingerprint_, 4);
+  }
+
+  size_t dataSize_;                  ///< 구조체 크기
+  std::vector<std::byte> defaults_;  ///< 기본값 데이터
+  std::vector<Element> elems_;       ///< 인코딩 원소 (오프셋 순)
+  std::vector<Run> runs_;            ///< 연속 8바이트 조각 구간
+  std::vector<uint32_t> scattered_;  ///< 구간에 속하지 않는 원소
+  uint32_t fingerprint_ = 0;         ///< 스키마 지문
+  size_t maxEncoded_ = 0;            ///< 최대 인코딩 크기
+};
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_COMPACTCODEC_HPP
@@ -0,0 +1,206 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_CRC_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_CRC_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define NEXUM_COM_EXTERNAL_CRC_X86 1
+#endif
+
+/**
+ * @brief E2E 보호용 CRC 모음 (AUTOSAR Crc 라이브러리 매개변수)
+ *
+ * - CRC8: SAE J1850 (다항식 0x1D, 초기값/최종 XOR 0xFF)
+ * - CRC16: CCITT-FALSE (다항식 0x1021, 초기값 0xFFFF, 최종 XOR 없음)
+ * - CRC32C: Castagnoli (반사 다항식 0x82F63B78, 초기값/최종 XOR 0xFFFFFFFF)
+ *
+ * CRC32C는 SSE4.2를 지원하는 x86-64에서 crc32 명령을, 그 외에는
+ * slicing-by-8 테이블을 사용합니다 (실행 시 한 번 판별).
+ * update 계열은 초기값/최종 XOR 없이 레지스터만 갱신하므로 여러 구간을
+ * 이어서 계산할 수 있습니다.
+ */
+struct Crc {
+  static constexpr uint8_t kCrc8Init = 0xFF;
+  static constexpr uint16_t kCrc16Init = 0xFFFF;
+  static constexpr uint32_t kCrc32cInit = 0xFFFFFFFF;
+
+  /** @brief CRC8 (SAE J1850) */
+  static uint8_t crc8(std::span<const std::byte> data) {
+    return crc8Update(kCrc8Init, data) ^ 0xFF;
+  }
+
+  /** @brief CRC16 (CCITT-FALSE) */
+  static uint16_t crc16(std::span<const std::byte> data) {
+    return crc16Update(kCrc16Init, data);
+  }
+
+  /** @brief CRC32C (Castagnoli) */
+  static uint32_t crc32c(std::span<const std::byte> data) {
+    return crc32cUpdate(kCrc32cInit, data) ^ 0xFFFFFFFF;
+  }
+
+  /** @brief CRC8 레지스터 갱신 */
+  static uint8_t crc8Update(uint8_t crc, std::span<const std::byte> data) {
+    const auto& t = crc8Table();
+    for (std::byte b : data) crc = t[crc ^ static_cast<uint8_t>(b)];
+    return crc;
+  }
+
+  /** @brief CRC16 레지스터 갱신 */
+  static uint16_t crc16Update(uint16_t crc, std::span<const std::byte> data) {
+    const auto& t = crc16Table();
+    for (std::byte b : data)
+      crc = static_cast<uint16_t>(
+          (crc << 8) ^ t[((crc >> 8) ^ static_cast<uint8_t>(b)) & 0xFF]);
+    return crc;
+  }
+
+  /** @brief CRC32C 레지스터 갱신 (하드웨어 지원 시 crc32 명령) */
+  static uint32_t crc32cUpdate(uint32_t crc, std::span<const std::byte> data) {
+#ifdef NEXUM_COM_EXTERNAL_CRC_X86
+    if (hasSse42()) return crc32cHardware(crc, data);
+#endif
+    return crc32cSoftware(crc, data);
+  }
+
+  /** @brief CRC32C slicing-by-8 구현 (하드웨어 경로 검증/비교용) */
+  static uint32_t crc32cSoftware(uint32_t crc,
+                                 std::span<const std::byte> data) {
+    const auto& t = crc32cTables();
+    const std::byte* p = data.data();
+    size_t n = data.size();
+    while (n >= 8) {
+      uint32_t lo, hi;
+      std::memcpy(&lo, p, 4);  // little endian 가정
+      std::memcpy(&hi, p + 4, 4);
+      lo ^= crc;
+      crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^
+            t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^ t[3][hi & 0xFF] ^
+            t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+      p += 8;
+      n -= 8;
+    }
+    while (n--)
+      crc = (crc >> 8) ^ t[0][(crc ^ static_cast<uint8_t>(*p++)) & 0xFF];
+    return crc;
+  }
+
+  /** @brief CRC32C 하드웨어 경로 사용 여부 */
+  static bool hasSse42() {
+#ifdef NEXUM_COM_EXTERNAL_CRC_X86
+    static const bool supported = __builtin_cpu_supports("sse4.2");
+    return supported;
+#else
+    return false;
+#endif
+  }
+
+ private:
+#ifdef NEXUM_COM_EXTERNAL_CRC_X86
+  __attribute__((target("sse4.2"))) static uint32_t crc32cHardware(
+      uint32_t crc, std::span<const std::byte> data) {
+    const std::byte* p = data.data();
+    size_t n = data.size();
+    uint64_t c = crc;
+    while (n >= 8) {
+      uint64_t v;
+      std::memcpy(&v, p, 8);
+      c = _mm_crc32_u64(c, v);
+      p += 8;
+      n -= 8;
+    }
+    uint32_t c32 = static_cast<uint32_t>(c);
+    while (n--) c32 = _mm_crc32_u8(c32, static_cast<uint8_t>(*p++));
+    return c32;
+  }
+#endif
+
+  static const std::array<uint8_t, 256>& crc8Table() {
+    static constexpr auto table = [] {
+      std::array<uint8_t, 256> t{};
+      for (unsigned i = 0; i < 256; ++i) {
+        uint8_t c = static_cast<uint8_t>(i);
+        for (int k = 0; k < 8; ++k)
+          c = static_cast<uint8_t>((c & 0x80) ? (c << 1) ^ 0x1D : c << 1);
+        t[i] = c;
+      }
+      return t;
+    }();
+    return table;
+  }
+
+  static const std::array<uint16_t, 256>& crc16Table() {
+    static constexpr auto table = [] {
+      std::array<uint16_t, 256> t{};
+      for (unsigned i = 0; i < 256; ++i) {
+        uint16_t c = static_cast<uint16_t>(i << 8);
+        for (int k = 0; k < 8; ++k)
+          c = static_cast<uint16_t>((c & 0x8000) ? (c << 1) ^ 0x1021 : c << 1);
+        t[i] = c;
+      }
+      return t;
+    }();
+    return table;
+  }
+
+  using Crc32cTables = std::array<std::array<uint32_t, 256>, 8>;
+
+  static const Crc32cTables& crc32cTables() {
+    static constexpr auto tables = [] {
+      Crc32cTables t{};
+      for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; ++k)
+          c = (c & 1) ? (c >> 1) ^ 0x82F63B78 : c >> 1;
+        t[0][i] = c;
+      }
+      for (uint32_t i = 0; i < 256; ++i)
+        for (size_t s = 1; s < 8; ++s)
+          t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+      return t;
+    }();
+    return tables;
+  }
+};
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_CRC_HPP
@@ -0,0 +1,333 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_E2E_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_E2E_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "Crc.hpp"
+
+/**
+ * @brief E2E CRC 종류
+ */
+enum class E2ECrc : uint8_t {
+  None,    ///< CRC 없음 (카운터만)
+  Crc8,    ///< CRC8 SAE J1850 (1바이트)
+  Crc16,   ///< CRC16 CCITT-FALSE (2바이트)
+  Crc32C,  ///< CRC32C (4바이트)
+};
+
+/**
+ * @brief E2E 수신 판정 결과
+ */
+enum class E2EStatus : uint8_t {
+  Ok,             ///< 정상 (최초 수신 포함)
+  LengthError,    ///< 보호 필드가 페이로드 밖에 있음
+  CrcError,       ///< CRC 불일치
+  Repeated,       ///< 카운터가 이전과 같음
+  WrongSequence,  ///< 카운터 증분이 maxDeltaCounter 초과
+};
+
+/**
+ * @brief E2EStatus 이름 (로그/예외 메시지용)
+ */
+inline const char* e2eStatusName(E2EStatus s) {
+  switch (s) {
+    case E2EStatus::Ok:
+      return "Ok";
+    case E2EStatus::LengthError:
+      return "LengthError";
+    case E2EStatus::CrcError:
+      return "CrcError";
+    case E2EStatus::Repeated:
+      return "Repeated";
+    case E2EStatus::WrongSequence:
+      return "WrongSequence";
+  }
+  return "Unknown";
+}
+
+/**
+ * @brief 프레임별 E2E 보호 설정
+ *
+ * CRC/카운터 필드는 직렬화 페이로드 안의 바이트 오프셋으로 지정합니다
+ * (데이터 구조체에 해당 필드 자리를 두어야 합니다).
+ * CRC는 dataId 4바이트(little endian) 뒤에 CRC 필드를 제외한 페이로드를
+ * 이어서 계산하며, 결과는 little endian으로 기록됩니다.
+ * 4비트 카운터는 counterOffset 바이트의 하위 니블을 사용합니다.
+ */
+struct E2EProfile {
+  static constexpr size_t kNoField = SIZE_MAX;  ///< 필드 없음
+
+  E2ECrc crc = E2ECrc::Crc8;       ///< CRC 종류
+  size_t crcOffset = 0;            ///< CRC 필드 오프셋
+  size_t counterOffset = kNoField;  ///< 카운터 필드 오프셋 (없으면 kNoField)
+  uint8_t counterBits = 4;          ///< 카운터 폭 (4 / 8 / 16)
+  uint32_t dataId = 0;              ///< 데이터 ID (CRC에만 반영)
+  uint16_t maxDeltaCounter = 1;     ///< 허용 카운터 증분 (1이면 손실 불허)
+};
+
+/**
+ * @brief 한 프레임의 E2E 송신/수신 상태
+ *
+ * 송신 카운터는 protect 호출마다 원자적으로 증가하고, 수신 판정은 내부
+ * 락으로 직렬화됩니다. 최초 수신은 카운터와 무관하게 수락합니다.
+ */
+class E2EChannel {
+ public:
+  /**
+   * @brief 수신 통계
+   */
+  struct Stats {
+    uint64_t ok = 0;              ///< 수락
+    uint64_t lengthErrors = 0;    ///< 길이 오류
+    uint64_t crcErrors = 0;       ///< CRC 오류
+    uint64_t repeated = 0;        ///< 반복 수신
+    uint64_t sequenceErrors = 0;  ///< 카운터 점프 초과
+    uint64_t lost = 0;            ///< 수락된 점프로 추정한 손실 수
+  };
+
+  /**
+   * @brief 생성자
+   * @param profile 보호 설정
+   * @throws std::invalid_argument 카운터 폭/증분이 잘못된 경우
+   */
+  explicit E2EChannel(const E2EProfile& profile) : profile_(profile) {
+    if (profile_.counterOffset != E2EProfile::kNoField &&
+        profile_.counterBits != 4 && profile_.counterBits != 8 &&
+        profile_.counterBits != 16)
+      throw std::invalid_argument("E2EChannel: counterBits must be 4/8/16");
+    if (profile_.maxDeltaCounter == 0 ||
+        profile_.maxDeltaCounter >= counterModulus())
+      throw std::invalid_argument("E2EChannel: invalid maxDeltaCounter");
+  }
+
+  /**
+   * @brief 보호 설정 반환
+   */
+  const E2EProfile& profile() const { return profile_; }
+
+  /**
+   * @brief 송신 페이로드에 카운터/CRC 기록
+   * @param payload 직렬화된 페이로드 (제자리 수정)
+   * @throws std::runtime_error 보호 필드가 페이로드 밖에 있는 경우
+   */
+  void protect(std::span<std::byte> payload) {
+    if (!fits(payload.size()))
+      throw std::runtime_error(
+          "E2EChannel: payload too small for protection fields: " +
+          std::to_string(payload.size()));
+    if (hasCounter())
+      writeCounter(payload, static_cast<uint16_t>(txCounter_.fetch_add(
+                                1, std::memory_order_relaxed)));
+    if (profile_.crc == E2ECrc::None) return;
+    uint32_t crc = compute(payload);
+    for (size_t i = 0; i < crcWidth(); ++i)
+      payload[profile_.crcOffset + i] = std::byte(crc >> (8 * i));
+  }
+
+  /**
+   * @brief 수신 페이로드 판정 (통계 갱신)
+   * @param payload 수신 페이로드
+   * @return 판정 결과 (Ok가 아니면 적용하지 않아야 함)
+   */
+  E2EStatus check(std::span<const std::byte> payload) {
+    E2EStatus s = verify(payload);
+    switch (s) {
+      case E2EStatus::Ok:
+        ok_.fetch_add(1, std::memory_order_relaxed);
+        break;
+      case E2EStatus::LengthError:
+        lengthErrors_.fetch_add(1, std::memory_order_relaxed);
+        break;
+      case E2EStatus::CrcError:
+        crcErrors_.fetch_add(1, std::memory_order_relaxed);
+        break;
+      case E2EStatus::Repeated:
+        repeated_.fetch_add(1, std::memory_order_relaxed);
+        break;
+      case E2EStatus::WrongSequence:
+        sequenceErrors_.fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+    return s;
+  }
+
+  /**
+   * @brief 통계 스냅샷
+   */
+  Stats stats() const {
+    Stats s;
+    s.ok = ok_.load(std::memory_order_relaxed);
+    s.lengthErrors = lengthErrors_.load(std::memory_order_relaxed);
+    s.crcErrors = crcErrors_.load(std::memory_order_relaxed);
+    s.repeated = repeated_.load(std::memory_order_relaxed);
+    s.sequenceErrors = sequenceErrors_.load(std::memory_order_relaxed);
+    s.lost = lost_.load(std::memory_order_relaxed);
+    return s;
+  }
+
+  /**
+   * @brief 수신 상태 초기화 (다음 수신을 최초 수신으로 취급)
+   */
+  void resync() {
+    std::lock_guard<std::mutex> lock(rxMutex_);
+    synced_ = false;
+  }
+
+ private:
+  E2EStatus verify(std::span<const std::byte> payload) {
+    if (!fits(payload.size())) return E2EStatus::LengthError;
+    if (profile_.crc != E2ECrc::None) {
+      uint32_t got = 0;
+      for (size_t i = 0; i < crcWidth(); ++i)
+        got |= static_cast<uint32_t>(payload[profile_.crcOffset + i])
+               << (8 * i);
+      if (got != compute(payload)) return E2EStatus::CrcError;
+    }
+    if (!hasCounter()) return E2EStatus::Ok;
+
+    uint32_t counter = readCounter(payload);
+    std::lock_guard<std::mutex> lock(rxMutex_);
+    if (!synced_) {
+      synced_ = true;
+      lastCounter_ = counter;
+      return E2EStatus::Ok;
+    }
+    uint32_t delta = (counter - lastCounter_) & (counterModulus() - 1);
+    if (delta == 0) return E2EStatus::Repeated;
+    lastCounter_ = counter;  // 점프 후에는 새 값 기준으로 재동기화
+    if (delta > profile_.maxDeltaCounter) return E2EStatus::WrongSequence;
+    if (delta > 1) lost_.fetch_add(delta - 1, std::memory_order_relaxed);
+    return E2EStatus::Ok;
+  }
+
+  bool hasCounter() const {
+    return profile_.counterOffset != E2EProfile::kNoField;
+  }
+
+  uint32_t counterModulus() const {
+    return hasCounter() ? (1u << profile_.counterBits) : 0x10000u;
+  }
+
+  size_t crcWidth() const {
+    switch (profile_.crc) {
+      case E2ECrc::Crc8:
+        return 1;
+      case E2ECrc::Crc16:
+        return 2;
+      case E2ECrc::Crc32C:
+        return 4;
+      default:
+        return 0;
+    }
+  }
+
+  bool fits(size_t size) const {
+    if (profile_.crc != E2ECrc::None &&
+        (profile_.crcOffset > size || size - profile_.crcOffset < crcWidth()))
+      return false;
+    if (hasCounter() &&
+        (profile_.counterOffset > size ||
+         size - profile_.counterOffset < (profile_.counterBits == 16 ? 2 : 1)))
+      return false;
+    return true;
+  }
+
+  void writeCounter(std::span<std::byte> p, uint16_t value) const {
+    std::byte* c = p.data() + profile_.counterOffset;
+    if (profile_.counterBits == 4) {
+      c[0] = (c[0] & std::byte{0xF0}) | std::byte(value & 0x0F);
+    } else {
+      c[0] = std::byte(value & 0xFF);
+      if (profile_.counterBits == 16) c[1] = std::byte(value >> 8);
+    }
+  }
+
+  uint32_t readCounter(std::span<const std::byte> p) const {
+    const std::byte* c = p.data() + profile_.counterOffset;
+    uint32_t v = static_cast<uint32_t>(c[0]);
+    if (profile_.counterBits == 4) return v & 0x0F;
+    if (profile_.counterBits == 16) v |= static_cast<uint32_t>(c[1]) << 8;
+    return v;
+  }
+
+  // dataId(LE 4바이트) + CRC 필드를 제외한 페이로드
+  uint32_t compute(std::span<const std::byte> p) const {
+    std::byte id[4];
+    for (int i = 0; i < 4; ++i) id[i] = std::byte(profile_.dataId >> (8 * i));
+    auto head = p.first(profile_.crcOffset);
+    auto tail = p.subspan(profile_.crcOffset + crcWidth());
+    switch (profile_.crc) {
+      case E2ECrc::Crc8: {
+        uint8_t c = Crc::crc8Update(Crc::kCrc8Init, id);
+        c = Crc::crc8Update(Crc::crc8Update(c, head), tail);
+        return c ^ 0xFF;
+      }
+      case E2ECrc::Crc16: {
+        uint16_t c = Crc::crc16Update(Crc::kCrc16Init, id);
+        return Crc::crc16Update(Crc::crc16Update(c, head), tail);
+      }
+      case E2ECrc::Crc32C: {
+        uint32_t c = Crc::crc32cUpdate(Crc::kCrc32cInit, id);
+        c = Crc::crc32cUpdate(Crc::crc32cUpdate(c, head), tail);
+        return c ^ 0xFFFFFFFF;
+      }
+      default:
+        return 0;
+    }
+  }
+
+  const E2EProfile profile_;          ///< 보호 설정
+  std::atomic<uint32_t> txCounter_{0};  ///< 송신 카운터
+  std::mutex rxMutex_;                ///< 수신 판정 락
+  bool synced_ = false;               ///< 최초 수신 완료 여부
+  uint32_t lastCounter_ = 0;          ///< 마지막 수락 카운터
+  std::atomic<uint64_t> ok_{0};              ///< 수락 수
+  std::atomic<uint64_t> lengthErrors_{0};    ///< 길이 오류 수
+  std::atomic<uint64_t> crcErrors_{0};       ///< CRC 오류 수
+  std::atomic<uint64_t> repeated_{0};        ///< 반복 수
+  std::atomic<uint64_t> sequenceErrors_{0};  ///< 카운터 점프 수
+  std::atomic<uint64_t> lost_{0};            ///< 추정 손실 수
+};
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_E2E_HPP
@@ -38,16 +38,25 @@
 #ifndef NEXUM_EXTERNAL_INTERFACE_FRAMEBASE_HPP
 #define NEXUM_EXTERNAL_INTERFACE_FRAMEBASE_HPP
 
+#include <cstddef>
 #include <cstring>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <shared_mutex>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
 #include "../bus_Factory/AutoRegister.hpp"
+#include "../frame/CompactCodec.hpp"
+#include "../frame/E2E.hpp"
 #include "../frame/IFrame.h"
+#include "../frame/LayoutConversion.hpp"
+#include "../frame/ZeroCopy.hpp"
 
 template <typename T>
 concept TriviallyCopyable = std::is_trivially_copyable_v<T>;
@@ -80,6 +89,10 @@ class FrameBase : public AutoRegister<Derived, IFrame> {
    */
   Data& data();
 
+  std::shared_lock<std::shared_mutex> lockShared() const override {
+    return std::shared_lock<std::shared_mutex>(data_rwlock_);
+  }
+
   /**
    * @brief 안전한 원시 데이터 접근(RAII 람다)
    */
@@ -106,6 +119,24 @@ class FrameBase : public AutoRegister<Derived, IFrame> {
   void setDeserializer(
       std::function<void(Data&, const std::vector<uint8_t>&)> d);
 
+  /**
+   * @brief 호출자 버퍼 기반 커스텀 직렬화 함수 지정
+   * @param s 직렬화 함수 (기록한 바이트 수 반환, 버퍼 부족 시 예외)
+   * @param maxSize 직렬화 결과의 최대 크기
+   * @note setSerializer로 지정한 함수는 대체됩니다.
+   */
+  void setSerializerInto(
+      std::function<size_t(const Data&, std::span<std::byte>)> s,
+      size_t maxSize = sizeof(DataT));
+
+  /**
+   * @brief 호출자 버퍼 기반 커스텀 역직렬화 함수 지정
+   * @param d 역직렬화 함수
+   * @note setDeserializer로 지정한 함수는 대체됩니다.
+   */
+  void setDeserializerFrom(
+      std::function<void(Data&, std::span<const std::byte>)> d);
+
   /**
    * @brief 데이터 직렬화
    * @return 직렬화 데이터
@@ -125,10 +156,148 @@ class FrameBase : public AutoRegister<Derived, IFrame> {
    */
   void deserialize(const std::vector<uint8_t>& raw) override;
 
+  /**
+   * @brief 직렬화 결과의 최대 크기
+   */
+  size_t serializedSize() const override;
+
+  /**
+   * @brief 호출자 버퍼에 직접 직렬화
+   * @param out 출력 버퍼
+   * @return 기록된 바이트 수
+   */
+  size_t serializeInto(std::span<std::byte> out) const override;
+
+  /**
+   * @brief 호출자 버퍼로부터 역직렬화 (콜백 없음)
+   * @param raw 직렬화 데이터
+   */
+  void deserializeFrom(std::span<const std::byte> raw) override;
+
+  /**
+   * @brief 호출자 버퍼로부터 역직렬화 후 콜백 알림
+   * @param raw 직렬화 데이터
+   * @return 성공 여부
+   */
+  bool deserializeFromWithPublish(std::span<const std::byte> raw) override;
+
+  /**
+   * @brief E2E 보호 없는 직렬화 (콜백 스냅샷/캡처용)
+   */
+  std::vector<uint8_t> snapshot() const override;
+
+  /**
+   * @brief E2E 보호 없는 버퍼 직렬화
+   */
+  size_t snapshotInto(std::span<std::byte> out) const override;
+
+  /**
+   * @brief E2E 보호 설정 (송신 시 카운터/CRC 기록, 수신 시 검증)
+   *
+   * 검증에 실패한 수신 데이터는 적용하지 않습니다: deserialize 계열은
+   * 예외를, WithPublish 계열은 false를 반환하며 콜백을 호출하지 않습니다.
+   * 압축/제로카피 와이어 포맷에서도 카운터/CRC 오프셋은 데이터 구조체
+   * 기준이며, 보호는 인코딩 전 구조체에, 검증은 디코딩한 구조체에
+   * 적용합니다.
+   * @param profile 보호 설정
+   * @note setSerializer와 같이 송수신 시작 전에 호출해야 합니다.
+   */
+  void setE2EProfile(const E2EProfile& profile);
+
+  /**
+   * @brief E2E 보호 해제
+   */
+  void clearE2EProfile();
+
+  /**
+   * @brief E2E 수신 통계 (보호 미설정 시 0)
+   */
+  E2EChannel::Stats e2eStats() const;
+
+  /**
+   * @brief 압축 와이어 포맷 사용 (CompactCodec으로 직렬화 함수 교체)
+   *
+   * 등록된 신호로 코덱을 구성하므로 registerSignal 이후에 호출해야
+   * 합니다. 송수신 양쪽이 같은 구조체/신호 구성을 가져야 하며, 다르면
+   * 역직렬화가 예외를 던집니다. setSerializer 계열을 다시 호출하면
+   * 해제됩니다.
+   * @param defaults 생략 기준 기본값 (이 값과 같은 원소는 전송하지 않음)
+   * @throws std::logic_error 레이아웃 변환(setLayoutVersion) 사용 중
+   */
+  void setCompactEncoding(const Data& defaults = Data{});
+
+  /**
+   * @brief 사용 중인 압축 코덱 (미사용 시 nullptr)
+   */
+  const CompactCodec* compactCodec() const { return compact_.get(); }
+
+  /**
+   * @brief 제로카피 와이어 포맷 사용 (ZeroCopySchema로 직렬화 함수 교체)
+   *
+   * 송신 페이로드는 오프셋 테이블 + 데이터 구조체 원본이며, 수신 측은
+   * ZeroCopyView로 역직렬화 없이 읽을 수 있습니다. 이 프레임으로
+   * 역직렬화할 때 스키마가 같으면 memcpy 한 번, 다르면 이름이 같고
+   * 크기가 같은 신호만 복사하고 나머지는 defaults를 씁니다.
+   * registerSignal 이후에 호출해야 하며 setSerializer 계열을 다시
+   * 호출하면 해제됩니다.
+   * @param defaults 스키마가 다를 때 빠진 필드의 기본값
+   * @throws std::logic_error 레이아웃 변환(setLayoutVersion) 사용 중
+   *         (스키마가 다른 송신자는 이름 기준 복사로 이미 처리됨)
+   */
+  void setZeroCopyEncoding(const Data& defaults = Data{});
+
+  /**
+   * @brief 사용 중인 제로카피 스키마 (미사용 시 nullptr)
+   */
+  const ZeroCopySchema* zeroCopySchema() const { return zeroCopy_.get(); }
+
+  /**
+   * @brief 현재 데이터 레이아웃 버전 지정 (레이아웃 변환 활성화)
+   *
+   * 현재 레이아웃은 등록된 신호로 구성하므로 registerSignal 이후에
+   * 호출해야 합니다. 버전 필드는 데이터 구조체 안의 little endian
+   * uint16이며, 모든 버전에서 같은 오프셋에 있어야 합니다. 버전 필드가
+   * 없으면 페이로드 크기로 레이아웃을 구분합니다.
+   * @param version 현재 레이아웃 버전
+   * @param versionOffset 버전 필드 오프셋 (없으면 kNoVersionField)
+   * @param defaults 변환 시 원본에 없는 필드의 기본값
+   * @note E2E 검증은 변환 전 수신 페이로드에 대해 수행됩니다.
+   * @throws std::logic_error 압축/제로카피 와이어 포맷 사용 중 (버전
+   *         필드가 인코딩된 페이로드 안에 있지 않으므로 함께 쓸 수 없음)
+   */
+  void setLayoutVersion(uint16_t version,
+                        size_t versionOffset = FrameLayout::kNoVersionField,
+                        const Data& defaults = Data{});
+
+  /**
+   * @brief 이전(또는 다른) 레이아웃 등록 및 변환 프로그램 컴파일
+   *
+   * 이후 해당 레이아웃의 페이로드는 역직렬화 시 현재 레이아웃으로
+   * 변환되어 적용됩니다 (커스텀 역직렬화 함수는 거치지 않음).
+   * 데이터 락을 배타적으로 잡고 등록하므로 동시 역직렬화 중에도
+   * 호출할 수 있습니다.
+   * @param layout 원본 레이아웃
+   * @throws std::logic_error setLayoutVersion 이전이거나 구분 불가한 경우
+   */
+  void addLayout(const FrameLayout& layout);
+
+  /**
+   * @brief 현재 레이아웃 버전 (레이아웃 변환 미사용 시 0)
+   */
+  uint16_t layoutVersion() const;
+
+  /**
+   * @brief 등록된 변환 프로그램 조회
+   * @param version 원본 레이아웃 버전
+   * @return 프로그램 포인터 (없으면 nullptr, 이후 addLayout에도 유효)
+   */
+  const LayoutProgram* layoutProgram(uint16_t version) const;
+
   /**
    * @brief 프레임 인스턴스 이름 반환
    */
   std::string id() const override;
+  std::string_view idView() const noexcept override { return instanceName_; }
 
  protected:
   Data data_;                              ///< 데이터 구조체
@@ -136,12 +305,69 @@ class FrameBase : public AutoRegister<Derived, IFrame> {
   std::function<std::vector<uint8_t>(const Data&)>
       serializer_;  ///< 직렬화 함수
   std::function<void(Data&, const std::vector<uint8_t>&)>
-      deserializer_;          ///< 역직렬화 함수
-  std::string instanceName_;  ///< 인스턴스 이름
+      deserializer_;  ///< 역직렬화 함수
+  std::function<size_t(const Data&, std::span<std::byte>)>
+      serializerInto_;  ///< 버퍼 직렬화 함수
+  std::function<void(Data&, std::span<const std::byte>)>
+      deserializerFrom_;        ///< 버퍼 역직렬화 함수
+  size_t serializedSizeMax_;    ///< serializerInto_ 결과 최대 크기
+  std::string instanceName_;    ///< 인스턴스 이름
+  std::unique_ptr<E2EChannel> e2e_;  ///< E2E 보호 상태 (없으면 nullptr)
+  std::shared_ptr<const CompactCodec> compact_;  ///< 압축 코덱
+  std::shared_ptr<const ZeroCopySchema> zeroCopy_;  ///< 제로카피 스키마
 
   const char* rawData() const override;
   char* rawData() override;
   size_t rawDataSize() const override;
+  bool copyRawUnlocked(std::span<std::byte> out) const override;
+
+  /**
+   * @brief Atomic 신호와 일관된 데이터로 함수 실행 (shared 락 보유 상태)
+   *
+   * Atomic 신호가 없으면 data_를 그대로, 있으면 버전 프로토콜로 얻은
+   * 복사본을 전달합니다.
+   */
+  template <typename Fn>
+  decltype(auto) withStableData(Fn&& fn) const;
+
+  /**
+   * @brief data_ 전체 쓰기 (exclusive 락 보유 상태)
+   *
+   * Atomic 신호 setter는 락 없이 쓰므로, Atomic 신호가 있으면 복사본을
+   * 수정한 뒤 IFrame::seqlockStore로 반영해 같은 바이트의 일반 쓰기와
+   * 원자 쓰기가 겹치지 않게 합니다. 없으면 data_를 직접 수정합니다.
+   */
+  template <typename Fn>
+  void mutateData(Fn&& fn);
+
+ private:
+  // E2E 검증 후 적용 (검증 실패 시 데이터 미변경, 결과 반환)
+  E2EStatus applyRaw(const std::vector<uint8_t>& raw, bool* converted);
+  E2EStatus applyRawFrom(std::span<const std::byte> raw, bool* converted);
+  // 구조체를 인코딩하는 와이어 포맷 사용 여부 (E2E는 구조체 기준)
+  bool encodedWire() const { return compact_ || zeroCopy_; }
+  // 인코딩 와이어 포맷 + E2E: 보호한 구조체 복사본 / 디코딩 후 검증·적용
+  Data protectedCopy() const;
+  E2EStatus applyDecoded(std::span<const std::byte> raw);
+  // 가변 크기 와이어 포맷 사용 중이면 크기와 무관하게 성공
+  bool acceptsWireSize(size_t n) const {
+    return n == sizeof(DataT) || compact_ || zeroCopy_;
+  }
+  // 다른 레이아웃 페이로드면 변환해 적용 (데이터 락 보유 상태)
+  bool applyLayout(std::span<const std::byte> raw);
+  // 버전으로 변환 프로그램 조회 (데이터 락 보유 상태)
+  const LayoutProgram* findLayoutProgram(uint16_t version) const;
+
+  /**
+   * @brief 레이아웃 변환 상태
+   */
+  struct LayoutState {
+    FrameLayout current;                 ///< 현재 레이아웃
+    size_t versionOffset;                ///< 버전 필드 오프셋
+    Data defaults;                       ///< 변환 기본값
+    std::deque<LayoutProgram> programs;  ///< 원본 레이아웃별 (주소 고정)
+  };
+  std::unique_ptr<LayoutState> layout_;  ///< 레이아웃 변환 (없으면 nullptr)
 };
 
 // ----- FrameBase<DataT,Derived> 구현 -----
@@ -149,7 +375,7 @@ class FrameBase : public AutoRegister<Derived, IFrame> {
 template <typename DataT, typename Derived>
   requires TriviallyCopyable<DataT>
 inline FrameBase<DataT, Derived>::FrameBase(const std::string& instanceName)
-    : instanceName_(instanceName) {
+    : serializedSizeMax_(sizeof(DataT)), instanceName_(instanceName) {
   std::memset(&data_, 0, sizeof(DataT));
   serializer_ = [](const Data& d) {
     std::vector<uint8_t> buf(sizeof(DataT));
@@ -163,6 +389,22 @@ inline FrameBase<DataT, Derived>::FrameBase(const std::string& instanceName)
                                std::to_string(sizeof(DataT)));
     std::memcpy(&d, buf.data(), sizeof(DataT));
   };
+  serializerInto_ = [](const Data& d, std::span<std::byte> out) -> size_t {
+    if (out.size() < sizeof(DataT))
+      throw std::runtime_error(
+          "FrameBase: serializeInto buffer too small: got " +
+          std::to_string(out.size()) + ", need " +
+          std::to_string(sizeof(DataT)));
+    std::memcpy(out.data(), &d, sizeof(DataT));
+    return sizeof(DataT);
+  };
+  deserializerFrom_ = [](Data& d, std::span<const std::byte> buf) {
+    if (buf.size() != sizeof(DataT))
+      throw std::runtime_error("FrameBase: deserialize size mismatch: got " +
+                               std::to_string(buf.size()) + ", expected " +
+                               std::to_string(sizeof(DataT)));
+    std::memcpy(&d, buf.data(), sizeof(DataT));
+  };
 }
 
 template <typename DataT, typename Derived>
@@ -186,7 +428,9 @@ template <typename DataT, typename Derived>
 inline void FrameBase<DataT, Derived>::readRawData(
     std::function<void(const char*, size_t)> func) const {
   std::shared_lock<std::shared_mutex> lock(data_rwlock_);
-  func(reinterpret_cast<const char*>(&data_), sizeof(DataT));
+  withStableData([&](const Data& d) {
+    func(reinterpret_cast<const char*>(&d), sizeof(DataT));
+  });
 }
 
 template <typename DataT, typename Derived>
@@ -194,7 +438,10 @@ template <typename DataT, typename Derived>
 inline void FrameBase<DataT, Derived>::writeRawData(
     std::function<void(char*, size_t)> func) {
   std::unique_lock<std::shared_mutex> lock(data_rwlock_);
-  func(reinterpret_cast<char*>(&data_), sizeof(DataT));
+  typename IFrame::WriteScope scope(*this);
+  mutateData([&](Data& d) {
+    func(reinterpret_cast<char*>(&d), sizeof(DataT));
+  });
 }
 
 template <typename DataT, typename Derived>
@@ -217,6 +464,38 @@ inline size_t FrameBase<DataT, Derived>::rawDataSize() const {
   return sizeof(DataT);
 }
 
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline bool FrameBase<DataT, Derived>::copyRawUnlocked(
+    std::span<std::byte> out) const {
+  if (out.size() < sizeof(DataT)) return false;
+  // 쓰기와 겹칠 수 있는 복사: tryReadVersioned가 버전으로 검증 후 채택
+  IFrame::seqlockCopy(out.data(), &data_, sizeof(DataT));
+  return true;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+template <typename Fn>
+inline decltype(auto) FrameBase<DataT, Derived>::withStableData(
+    Fn&& fn) const {
+  if (!this->hasAtomicSignals_) return fn(data_);
+  Data snapshot;
+  this->readConsistent(&snapshot, &data_, sizeof(DataT));
+  return fn(snapshot);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+template <typename Fn>
+inline void FrameBase<DataT, Derived>::mutateData(Fn&& fn) {
+  if (!this->hasAtomicSignals_) return fn(data_);
+  Data tmp;
+  IFrame::seqlockCopy(&tmp, &data_, sizeof(DataT));
+  fn(tmp);
+  IFrame::seqlockStore(&data_, &tmp, sizeof(DataT));
+}
+
 template <typename DataT, typename Derived>
   requires TriviallyCopyable<DataT>
 inline size_t FrameBase<DataT, Derived>::size() const {
@@ -227,41 +506,416 @@ template <typename DataT, typename Derived>
   requires TriviallyCopyable<DataT>
 inline void FrameBase<DataT, Derived>::setSerializer(
     std::function<std::vector<uint8_t>(const Data&)> s) {
+  compact_.reset();
+  zeroCopy_.reset();
   serializer_ = std::move(s);
+  serializerInto_ = nullptr;  // 버퍼 경로는 serializer_ 결과를 복사
 }
 
 template <typename DataT, typename Derived>
   requires TriviallyCopyable<DataT>
 inline void FrameBase<DataT, Derived>::setDeserializer(
     std::function<void(Data&, const std::vector<uint8_t>&)> d) {
+  compact_.reset();
+  zeroCopy_.reset();
   deserializer_ = std::move(d);
+  deserializerFrom_ = nullptr;  // 버퍼 경로는 vector로 복사 후 위임
 }
 
 template <typename DataT, typename Derived>
   requires TriviallyCopyable<DataT>
-inline std::vector<uint8_t> FrameBase<DataT, Derived>::serialize() const {
+inline void FrameBase<DataT, Derived>::setSerializerInto(
+    std::function<size_t(const Data&, std::span<std::byte>)> s,
+    size_t maxSize) {
+  compact_.reset();
+  zeroCopy_.reset();
+  serializerInto_ = std::move(s);
+  serializedSizeMax_ = maxSize;
+  serializer_ = nullptr;  // vector 경로는 serializerInto_로 위임
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline void FrameBase<DataT, Derived>::setDeserializerFrom(
+    std::function<void(Data&, std::span<const std::byte>)> d) {
+  compact_.reset();
+  zeroCopy_.reset();
+  deserializerFrom_ = std::move(d);
+  deserializer_ = nullptr;  // vector 경로는 deserializerFrom_로 위임
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline std::vector<uint8_t> FrameBase<DataT, Derived>::snapshot() const {
   std::shared_lock<std::shared_mutex> lock(data_rwlock_);
-  return serializer_(data_);
+  return withStableData([&](const Data& d) {
+    if (serializer_) return serializer_(d);
+    std::vector<uint8_t> buf(serializedSizeMax_);
+    buf.resize(serializerInto_(
+        d, std::span<std::byte>(reinterpret_cast<std::byte*>(buf.data()),
+                                buf.size())));
+    return buf;
+  });
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline size_t FrameBase<DataT, Derived>::serializedSize() const {
+  if (serializerInto_) return serializedSizeMax_;
+  std::shared_lock<std::shared_mutex> lock(data_rwlock_);
+  return withStableData([&](const Data& d) { return serializer_(d).size(); });
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline size_t FrameBase<DataT, Derived>::snapshotInto(
+    std::span<std::byte> out) const {
+  std::shared_lock<std::shared_mutex> lock(data_rwlock_);
+  return withStableData([&](const Data& d) -> size_t {
+    if (serializerInto_) return serializerInto_(d, out);
+    std::vector<uint8_t> buf = serializer_(d);
+    if (buf.size() > out.size())
+      throw std::runtime_error(
+          "FrameBase: serializeInto buffer too small: got " +
+          std::to_string(out.size()) + ", need " +
+          std::to_string(buf.size()));
+    std::memcpy(out.data(), buf.data(), buf.size());
+    return buf.size();
+  });
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline std::vector<uint8_t> FrameBase<DataT, Derived>::serialize() const {
+  if (e2e_ && encodedWire()) {
+    const Data d = protectedCopy();
+    std::vector<uint8_t> buf(serializedSizeMax_);
+    buf.resize(serializerInto_(d, std::as_writable_bytes(std::span(buf))));
+    return buf;
+  }
+  std::vector<uint8_t> buf = FrameBase::snapshot();
+  if (e2e_) e2e_->protect(std::as_writable_bytes(std::span(buf)));
+  return buf;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline size_t FrameBase<DataT, Derived>::serializeInto(
+    std::span<std::byte> out) const {
+  if (e2e_ && encodedWire()) return serializerInto_(protectedCopy(), out);
+  size_t n = FrameBase::snapshotInto(out);
+  if (e2e_) e2e_->protect(out.first(n));
+  return n;
 }
 
 template <typename DataT, typename Derived>
   requires TriviallyCopyable<DataT>
 inline bool FrameBase<DataT, Derived>::deserializeWithPublish(
     const std::vector<uint8_t>& raw) {
-  {
-    std::unique_lock<std::shared_mutex> lock(data_rwlock_);
-    deserializer_(data_, raw);
-  }
+  bool converted = false;
+  if (applyRaw(raw, &converted) != E2EStatus::Ok) return false;
   this->notifyCallbacks();
-  return raw.size() == sizeof(DataT);
+  return converted || acceptsWireSize(raw.size());
 }
 
 template <typename DataT, typename Derived>
   requires TriviallyCopyable<DataT>
 inline void FrameBase<DataT, Derived>::deserialize(
     const std::vector<uint8_t>& raw) {
+  E2EStatus st = applyRaw(raw, nullptr);
+  if (st != E2EStatus::Ok)
+    throw std::runtime_error(std::string("FrameBase: E2E check failed: ") +
+                             e2eStatusName(st));
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline void FrameBase<DataT, Derived>::deserializeFrom(
+    std::span<const std::byte> raw) {
+  E2EStatus st = applyRawFrom(raw, nullptr);
+  if (st != E2EStatus::Ok)
+    throw std::runtime_error(std::string("FrameBase: E2E check failed: ") +
+                             e2eStatusName(st));
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline bool FrameBase<DataT, Derived>::deserializeFromWithPublish(
+    std::span<const std::byte> raw) {
+  bool converted = false;
+  if (applyRawFrom(raw, &converted) != E2EStatus::Ok) return false;
+  this->notifyCallbacks();
+  return converted || acceptsWireSize(raw.size());
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline E2EStatus FrameBase<DataT, Derived>::applyRaw(
+    const std::vector<uint8_t>& raw, bool* converted) {
+  std::unique_lock<std::shared_mutex> lock(data_rwlock_);
+  if (e2e_ && encodedWire()) return applyDecoded(std::as_bytes(std::span(raw)));
+  if (e2e_) {
+    E2EStatus st = e2e_->check(std::as_bytes(std::span(raw)));
+    if (st != E2EStatus::Ok) return st;
+  }
+  if (applyLayout(std::as_bytes(std::span(raw)))) {
+    if (converted) *converted = true;
+    return E2EStatus::Ok;
+  }
+  typename IFrame::WriteScope scope(*this);
+  mutateData([&](Data& d) {
+    if (deserializer_) {
+      deserializer_(d, raw);
+    } else {
+      deserializerFrom_(d, std::as_bytes(std::span(raw)));
+    }
+  });
+  return E2EStatus::Ok;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline E2EStatus FrameBase<DataT, Derived>::applyRawFrom(
+    std::span<const std::byte> raw, bool* converted) {
   std::unique_lock<std::shared_mutex> lock(data_rwlock_);
-  deserializer_(data_, raw);
+  if (e2e_ && encodedWire()) return applyDecoded(raw);
+  if (e2e_) {
+    E2EStatus st = e2e_->check(raw);
+    if (st != E2EStatus::Ok) return st;
+  }
+  if (applyLayout(raw)) {
+    if (converted) *converted = true;
+    return E2EStatus::Ok;
+  }
+  typename IFrame::WriteScope scope(*this);
+  mutateData([&](Data& d) {
+    if (deserializerFrom_) {
+      deserializerFrom_(d, raw);
+    } else {
+      const auto* p = reinterpret_cast<const uint8_t*>(raw.data());
+      deserializer_(d, std::vector<uint8_t>(p, p + raw.size()));
+    }
+  });
+  return E2EStatus::Ok;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline typename FrameBase<DataT, Derived>::Data
+FrameBase<DataT, Derived>::protectedCopy() const {
+  Data d;
+  {
+    std::shared_lock<std::shared_mutex> lock(data_rwlock_);
+    withStableData([&](const Data& s) { d = s; });
+  }
+  e2e_->protect(std::as_writable_bytes(std::span(&d, 1)));
+  return d;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline E2EStatus FrameBase<DataT, Derived>::applyDecoded(
+    std::span<const std::byte> raw) {
+  Data tmp;
+  IFrame::seqlockCopy(&tmp, &data_, sizeof(DataT));
+  deserializerFrom_(tmp, raw);
+  E2EStatus st = e2e_->check(std::as_bytes(std::span(&tmp, 1)));
+  if (st != E2EStatus::Ok) return st;
+  typename IFrame::WriteScope scope(*this);
+  mutateData([&](Data& d) { d = tmp; });
+  return E2EStatus::Ok;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline void FrameBase<DataT, Derived>::setE2EProfile(
+    const E2EProfile& profile) {
+  e2e_ = std::make_unique<E2EChannel>(profile);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline void FrameBase<DataT, Derived>::clearE2EProfile() {
+  e2e_.reset();
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline E2EChannel::Stats FrameBase<DataT, Derived>::e2eStats() const {
+  return e2e_ ? e2e_->stats() : E2EChannel::Stats{};
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline void FrameBase<DataT, Derived>::setCompactEncoding(
+    const Data& defaults) {
+  if (layout_)
+    throw std::logic_error(
+        "FrameBase: compact encoding cannot be combined with layout "
+        "versioning: " + instanceName_);
+  auto codec = std::make_shared<const CompactCodec>(
+      this->signalEntries(), std::as_bytes(std::span(&defaults, 1)));
+  setSerializerInto(
+      [codec](const Data& d, std::span<std::byte> out) {
+        return codec->encode(std::as_bytes(std::span(&d, 1)), out);
+      },
+      codec->maxEncodedSize());
+  setDeserializerFrom([codec](Data& d, std::span<const std::byte> in) {
+    Data tmp;  // 형식 오류 시 기존 데이터 유지
+    codec->decode(in, std::as_writable_bytes(std::span(&tmp, 1)));
+    d = tmp;
+  });
+  compact_ = std::move(codec);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline void FrameBase<DataT, Derived>::setZeroCopyEncoding(
+    const Data& defaults) {
+  if (layout_)
+    throw std::logic_error(
+        "FrameBase: zero-copy encoding cannot be combined with layout "
+        "versioning: " + instanceName_);
+  auto schema = std::make_shared<const ZeroCopySchema>(this->signalEntries(),
+                                                       sizeof(DataT));
+  setSerializerInto(
+      [schema](const Data& d, std::span<std::byte> out) {
+        return schema->encode(std::as_bytes(std::span(&d, 1)), out);
+      },
+      schema->encodedSize());
+  setDeserializerFrom([schema, defaults](Data& d,
+                                         std::span<const std::byte> in) {
+    ZeroCopyView view = ZeroCopyView::parse(in);
+    if (view.schemaHash() == schema->schemaHash() &&
+        view.payload().size() == sizeof(DataT)) {
+      std::memcpy(&d, view.payload().data(), sizeof(DataT));
+      return;
+    }
+    // 스키마가 다른 송신자: 이름/크기가 같은 신호만 옮김
+    ZeroCopyView mine(*schema, std::as_bytes(std::span(&defaults, 1)));
+    Data tmp = defaults;
+    auto* dst = reinterpret_cast<std::byte*>(&tmp);
+    for (size_t i = 0; i < mine.fieldCount(); ++i) {
+      ZeroCopyEntry e = mine.entry(i);
+      size_t j = view.indexOf(e.nameHash);
+      if (j == SIZE_MAX) continue;
+      ZeroCopyEntry src = view.entry(j);
+      if (src.size != e.size || src.type != e.type) continue;
+      std::memcpy(dst + e.offset, view.payload().data() + src.offset, e.size);
+    }
+    d = tmp;
+  });
+  zeroCopy_ = std::move(schema);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline bool FrameBase<DataT, Derived>::applyLayout(
+    std::span<const std::byte> raw) {
+  if (!layout_) return false;
+  const LayoutProgram* prog = nullptr;
+  size_t off = layout_->versionOffset;
+  if (off != FrameLayout::kNoVersionField) {
+    if (off > raw.size() || raw.size() - off < 2) return false;
+    auto v = static_cast<uint16_t>(static_cast<uint16_t>(raw[off]) |
+                                   static_cast<uint16_t>(raw[off + 1]) << 8);
+    if (v == layout_->current.version()) return false;
+    prog = findLayoutProgram(v);
+    if (!prog)
+      throw std::runtime_error("FrameBase: unknown layout version " +
+                               std::to_string(v) + " for " + instanceName_);
+  } else {
+    if (raw.size() == sizeof(DataT)) return false;
+    for (const auto& p : layout_->programs)
+      if (p.fromSize() == raw.size()) prog = &p;
+    if (!prog) return false;  // 기존 경로에서 크기 오류 처리
+  }
+  typename IFrame::WriteScope scope(*this);
+  mutateData([&](Data& data) {
+    prog->run(raw, std::as_writable_bytes(std::span(&data, 1)));
+    if (off != FrameLayout::kNoVersionField) {
+      uint16_t v = layout_->current.version();
+      auto* d = reinterpret_cast<std::byte*>(&data);
+      d[off] = std::byte(v & 0xFF);
+      d[off + 1] = std::byte(v >> 8);
+    }
+  });
+  return true;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline void FrameBase<DataT, Derived>::setLayoutVersion(
+    uint16_t version, size_t versionOffset, const Data& defaults) {
+  if (versionOffset != FrameLayout::kNoVersionField &&
+      (versionOffset > sizeof(DataT) || sizeof(DataT) - versionOffset < 2))
+    throw std::invalid_argument("FrameBase: version field out of range");
+  if (compact_ || zeroCopy_)
+    throw std::logic_error(
+        "FrameBase: layout versioning cannot be combined with compact or "
+        "zero-copy encoding: " + instanceName_);
+  auto state = std::make_unique<LayoutState>(LayoutState{
+      FrameLayout::fromSignals(version, sizeof(DataT), this->signalEntries()),
+      versionOffset, defaults, {}});
+  std::unique_lock<std::shared_mutex> lock(data_rwlock_);
+  if (versionOffset != FrameLayout::kNoVersionField) {
+    typename IFrame::WriteScope scope(*this);
+    mutateData([&](Data& data) {
+      auto* d = reinterpret_cast<std::byte*>(&data);
+      d[versionOffset] = std::byte(version & 0xFF);
+      d[versionOffset + 1] = std::byte(version >> 8);
+    });
+    auto* def = reinterpret_cast<std::byte*>(&state->defaults);
+    def[versionOffset] = std::byte(version & 0xFF);
+    def[versionOffset + 1] = std::byte(version >> 8);
+  }
+  layout_ = std::move(state);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline void FrameBase<DataT, Derived>::addLayout(
+    const FrameLayout& layout) {
+  std::unique_lock<std::shared_mutex> lock(data_rwlock_);
+  if (!layout_)
+    throw std::logic_error("FrameBase: setLayoutVersion not called: " +
+                           instanceName_);
+  bool bySize = layout_->versionOffset == FrameLayout::kNoVersionField;
+  if (layout.version() == layout_->current.version() ||
+      (bySize && layout.size() == sizeof(DataT)))
+    throw std::logic_error("FrameBase: layout indistinguishable from current");
+  for (const auto& p : layout_->programs)
+    if (p.fromVersion() == layout.version() ||
+        (bySize && p.fromSize() == layout.size()))
+      throw std::logic_error("FrameBase: duplicate layout " +
+                             std::to_string(layout.version()));
+  layout_->programs.emplace_back(
+      layout, layout_->current,
+      std::as_bytes(std::span(&layout_->defaults, 1)));
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline uint16_t FrameBase<DataT, Derived>::layoutVersion() const {
+  return layout_ ? layout_->current.version() : 0;
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline const LayoutProgram* FrameBase<DataT, Derived>::layoutProgram(
+    uint16_t version) const {
+  std::shared_lock<std::shared_mutex> lock(data_rwlock_);
+  return findLayoutProgram(version);
+}
+
+template <typename DataT, typename Derived>
+  requires TriviallyCopyable<DataT>
+inline const LayoutProgram* FrameBase<DataT, Derived>::findLayoutProgram(
+    uint16_t version) const {
+  if (!layout_) return nullptr;
+  for (const auto& p : layout_->programs)
+    if (p.fromVersion() == version) return &p;
+  return nullptr;
 }
 
 template <typename DataT, typename Derived>
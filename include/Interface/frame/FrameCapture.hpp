@@ -0,0 +1,410 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_FRAMECAPTURE_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_FRAMECAPTURE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "IFrame.h"
+
+/**
+ * @brief 프레임 트래픽 pcapng 캡처 (IFrameTap 구현)
+ *
+ * install() 이후 publish, 포트 수신/송신 이벤트를 pcapng 파일로 기록합니다.
+ * 링크 타입은 LINKTYPE_USER0(147)이며 패킷 데이터 형식은 다음과 같습니다.
+ *
+ * | 크기 | 내용                                         |
+ * |------|----------------------------------------------|
+ * | 1    | 형식 버전 (1)                                |
+ * | 1    | 이벤트 (0: Publish, 1: PortRx, 2: PortTx)    |
+ * | 1    | 프레임 ID 길이 F                             |
+ * | 1    | 포트 이름 길이 P                             |
+ * | 4    | 원래 페이로드 길이 (little endian)           |
+ * | F    | 프레임 ID                                    |
+ * | P    | 포트 이름                                    |
+ * | ...  | 페이로드 (snaplen에서 잘릴 수 있음)          |
+ *
+ * 이벤트 스레드는 고정 크기 슬롯 링(락 없는 bounded MPSC 큐)에 복사만
+ * 하고, 파일 쓰기는 백그라운드 스레드가 합니다. 링이 가득 차면 기다리지
+ * 않고 버린 뒤 dropped로 집계하므로 publish 지연이 파일 I/O에 묶이지
+ * 않습니다. 시각은 네트워크 트레이스와 맞추기 위해 system_clock(ns)입니다.
+ */
+class FrameCapture : public IFrameTap {
+ public:
+  /**
+   * @brief 캡처 설정
+   */
+  struct Config {
+    size_t slots = 4096;   ///< 링 슬롯 수 (2의 거듭제곱으로 올림)
+    size_t snaplen = 256;  ///< 이벤트당 최대 페이로드 바이트
+    bool publish = true;   ///< Publish 이벤트 기록
+    bool portRx = true;    ///< 포트 수신 이벤트 기록
+    bool portTx = true;    ///< 포트 송신 이벤트 기록
+    std::chrono::milliseconds flushInterval{200};  ///< 파일 flush 주기
+  };
+
+  /**
+   * @brief 캡처 통계
+   */
+  struct Stats {
+    uint64_t captured = 0;   ///< 링에 기록한 이벤트
+    uint64_t dropped = 0;    ///< 링 포화로 버린 이벤트
+    uint64_t truncated = 0;  ///< snaplen에서 잘린 이벤트
+    uint64_t written = 0;    ///< 파일에 쓴 이벤트
+    uint64_t bytes = 0;      ///< 파일에 쓴 바이트
+  };
+
+  /** @brief pcapng LINKTYPE_USER0 */
+  static constexpr uint16_t kLinkType = 147;
+  /** @brief 프레임 ID / 포트 이름 최대 길이 (초과분은 잘림) */
+  static constexpr size_t kMaxName = 64;
+
+  /**
+   * @brief 파일을 만들고 헤더(SHB, IDB)를 쓴 뒤 기록 스레드 시작
+   * @throws std::runtime_error 파일을 열 수 없을 때
+   */
+  FrameCapture(const std::string& path, Config config);
+
+  /**
+   * @brief 기본 설정으로 캡처 시작
+   * @throws std::runtime_error 파일을 열 수 없을 때
+   */
+  explicit FrameCapture(const std::string& path)
+      : FrameCapture(path, Config{}) {}
+
+  /**
+   * @brief 탭 해제, 남은 이벤트 기록 후 파일 닫기
+   */
+  ~FrameCapture() override;
+
+  FrameCapture(const FrameCapture&) = delete;
+  FrameCapture& operator=(const FrameCapture&) = delete;
+
+  /**
+   * @brief 전역 프레임 탭으로 설치 (기존 탭은 대체됨)
+   */
+  void install() {
+    IFrame::setFrameTap(std::shared_ptr<IFrameTap>(token_, this));
+  }
+
+  /**
+   * @brief 설치되어 있으면 전역 프레임 탭 해제
+   *
+   * 이 캡처를 붙잡고 진행 중인 호출이 끝날 때까지 기다립니다. 해제 후에는
+   * 새 호출이 이 캡처를 얻을 수 없으므로 대기는 유한합니다.
+   */
+  void uninstall();
+
+  /**
+   * @brief 지금까지 링에 들어온 이벤트를 파일에 쓰고 flush
+   */
+  void flush();
+
+  /**
+   * @brief 캡처 통계
+   */
+  Stats stats() const;
+
+  void onFrameEvent(const IFrame& frame, FrameEvent event,
+                    std::string_view port,
+                    std::span<const std::byte> payload) noexcept override;
+
+ private:
+  /** @brief 링 슬롯 메타데이터 (페이로드는 arena_의 같은 색인) */
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> seq{0};
+    uint64_t timestampNs = 0;
+    uint32_t origLen = 0;
+    uint32_t capLen = 0;
+    uint8_t event = 0;
+    uint8_t frameLen = 0;
+    uint8_t portLen = 0;
+    char names[2 * kMaxName];
+  };
+
+  void writerLoop();
+  bool drainOne();
+  void writeBlock(const void* data, size_t size);
+  void writeHeaders();
+
+  const Config config_;
+  const size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  std::vector<std::byte> arena_;  ///< 슬롯별 snaplen 바이트
+  alignas(64) std::atomic<uint64_t> enqueuePos_{0};
+  alignas(64) std::atomic<uint64_t> dequeuePos_{0};  ///< 기록 완료 위치
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<uint64_t> truncated_{0};
+
+  std::mutex fileMutex_;  ///< 파일 쓰기 / flush 보호
+  std::FILE* file_ = nullptr;
+  std::vector<std::byte> block_;  ///< EPB 조립 버퍼 (기록 스레드 전용)
+  std::atomic<uint64_t> written_{0};
+  std::atomic<uint64_t> bytes_{0};
+  std::atomic<bool> stop_{false};
+  std::thread writer_;
+  /// 탭 참조 수 추적용 (install이 aliasing shared_ptr로 공유)
+  std::shared_ptr<void> token_ = std::make_shared<char>(0);
+};
+
+// ------------------- FrameCapture 구현부 -------------------
+
+inline FrameCapture::FrameCapture(const std::string& path, Config config)
+    : config_(config),
+      mask_(std::bit_ceil(std::max<size_t>(config.slots, 2)) - 1) {
+  slots_ = std::make_unique<Slot[]>(mask_ + 1);
+  for (size_t i = 0; i <= mask_; ++i)
+    slots_[i].seq.store(i, std::memory_order_relaxed);
+  arena_.resize((mask_ + 1) * config_.snaplen);
+  file_ = std::fopen(path.c_str(), "wb");
+  if (!file_)
+    throw std::runtime_error("FrameCapture: cannot open " + path);
+  std::setvbuf(file_, nullptr, _IOFBF, 1 << 16);
+  writeHeaders();
+  writer_ = std::thread([this] { writerLoop(); });
+}
+
+inline FrameCapture::~FrameCapture() {
+  uninstall();
+  stop_ = true;
+  if (writer_.joinable()) writer_.join();
+  std::fclose(file_);
+}
+
+inline void FrameCapture::uninstall() {
+  if (IFrame::frameTap() == this) IFrame::setFrameTap(nullptr);
+  while (token_.use_count() > 1) std::this_thread::yield();
+  std::atomic_thread_fence(std::memory_order_acquire);
+}
+
+inline void FrameCapture::onFrameEvent(
+    const IFrame& frame, FrameEvent event, std::string_view port,
+    std::span<const std::byte> payload) noexcept {
+  if ((event == FrameEvent::Publish && !config_.publish) ||
+      (event == FrameEvent::PortRx && !config_.portRx) ||
+      (event == FrameEvent::PortTx && !config_.portTx))
+    return;
+
+  // 슬롯 예약 (bounded MPSC 큐, 가득 차면 대기 없이 버림)
+  uint64_t pos = enqueuePos_.load(std::memory_order_relaxed);
+  Slot* slot;
+  for (;;) {
+    slot = &slots_[pos & mask_];
+    const uint64_t seq = slot->seq.load(std::memory_order_acquire);
+    const int64_t diff = static_cast<int64_t>(seq - pos);
+    if (diff == 0) {
+      if (enqueuePos_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      pos = enqueuePos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  std::byte* dst = &arena_[(pos & mask_) * config_.snaplen];
+  size_t orig = payload.size();
+  size_t cap = std::min(orig, config_.snaplen);
+  try {
+    if (!payload.empty()) {
+      std::memcpy(dst, payload.data(), cap);
+    } else if ((orig = frame.serializedSize()) <= config_.snaplen) {
+      cap = frame.snapshotInto(std::span(dst, config_.snaplen));
+      orig = cap;
+    } else {
+      frame.readRawData([&](const char* p, size_t n) {
+        orig = n;
+        cap = std::min(n, config_.snaplen);
+        std::memcpy(dst, p, cap);
+      });
+    }
+    std::string owned;  // idView()를 지원하지 않는 프레임만 할당
+    std::string_view id = frame.idView();
+    if (id.empty()) id = owned = frame.id();
+    slot->frameLen = static_cast<uint8_t>(std::min(id.size(), kMaxName));
+    std::memcpy(slot->names, id.data(), slot->frameLen);
+  } catch (...) {
+    cap = orig = 0;  // 직렬화 실패: 메타데이터만 기록
+    slot->frameLen = 0;
+  }
+  if (cap < orig) truncated_.fetch_add(1, std::memory_order_relaxed);
+  slot->portLen = static_cast<uint8_t>(std::min(port.size(), kMaxName));
+  std::memcpy(slot->names + slot->frameLen, port.data(), slot->portLen);
+  slot->timestampNs = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count());
+  slot->origLen = static_cast<uint32_t>(orig);
+  slot->capLen = static_cast<uint32_t>(cap);
+  slot->event = static_cast<uint8_t>(event);
+  slot->seq.store(pos + 1, std::memory_order_release);
+}
+
+/**
+ * @brief 링에서 이벤트 하나를 꺼내 EPB로 기록 (fileMutex_ 보유 상태)
+ * @return 꺼낸 이벤트가 없으면 false
+ */
+inline bool FrameCapture::drainOne() {
+  const uint64_t pos = dequeuePos_.load(std::memory_order_relaxed);
+  Slot& slot = slots_[pos & mask_];
+  if (slot.seq.load(std::memory_order_acquire) != pos + 1) return false;
+
+  const size_t names = slot.frameLen + slot.portLen;
+  const size_t data = 8 + names + slot.capLen;
+  const size_t padded = (data + 3) & ~size_t{3};
+  const uint32_t total = static_cast<uint32_t>(32 + padded);
+  const uint32_t origData = static_cast<uint32_t>(8 + names + slot.origLen);
+  block_.assign(total, std::byte{0});
+  std::byte* p = block_.data();
+  auto put32 = [&p](uint32_t v) {
+    std::memcpy(p, &v, 4);
+    p += 4;
+  };
+  put32(6);  // Enhanced Packet Block
+  put32(total);
+  put32(0);  // interface id
+  put32(static_cast<uint32_t>(slot.timestampNs >> 32));
+  put32(static_cast<uint32_t>(slot.timestampNs));
+  put32(static_cast<uint32_t>(data));
+  put32(origData);
+  const uint8_t head[4] = {1, slot.event, slot.frameLen, slot.portLen};
+  std::memcpy(p, head, 4);
+  p += 4;
+  put32(slot.origLen);
+  std::memcpy(p, slot.names, names);
+  p += names;
+  std::memcpy(p, &arena_[(pos & mask_) * config_.snaplen], slot.capLen);
+  p = block_.data() + total - 4;
+  put32(total);
+
+  slot.seq.store(pos + mask_ + 1, std::memory_order_release);  // 슬롯 반환
+  dequeuePos_.store(pos + 1, std::memory_order_release);
+  writeBlock(block_.data(), total);
+  written_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+inline void FrameCapture::writerLoop() {
+  auto lastFlush = std::chrono::steady_clock::now();
+  while (true) {
+    size_t n = 0;
+    {
+      std::lock_guard<std::mutex> lock(fileMutex_);
+      while (n < 1024 && drainOne()) ++n;
+      const auto now = std::chrono::steady_clock::now();
+      if (now - lastFlush >= config_.flushInterval) {
+        std::fflush(file_);
+        lastFlush = now;
+      }
+    }
+    if (n > 0) continue;
+    if (stop_.load(std::memory_order_acquire)) break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  std::lock_guard<std::mutex> lock(fileMutex_);
+  while (drainOne()) {
+  }
+  std::fflush(file_);
+}
+
+inline void FrameCapture::flush() {
+  const uint64_t target = enqueuePos_.load(std::memory_order_acquire);
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(fileMutex_);
+      // 예약만 되고 아직 채워지지 않은 슬롯은 채워질 때까지 기다림
+      while (dequeuePos_.load(std::memory_order_relaxed) < target &&
+             drainOne()) {
+      }
+      if (dequeuePos_.load(std::memory_order_relaxed) >= target) {
+        std::fflush(file_);
+        return;
+      }
+    }
+    std::this_thread::yield();
+  }
+}
+
+inline FrameCapture::Stats FrameCapture::stats() const {
+  Stats s;
+  s.captured = enqueuePos_.load(std::memory_order_relaxed);
+  s.dropped = dropped_.load(std::memory_order_relaxed);
+  s.truncated = truncated_.load(std::memory_order_relaxed);
+  s.written = written_.load(std::memory_order_relaxed);
+  s.bytes = bytes_.load(std::memory_order_relaxed);
+  return s;
+}
+
+inline void FrameCapture::writeBlock(const void* data, size_t size) {
+  std::fwrite(data, 1, size, file_);
+  bytes_.fetch_add(size, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Section Header Block + Interface Description Block (ns 해상도)
+ */
+inline void FrameCapture::writeHeaders() {
+  const uint32_t shb[7] = {0x0A0D0D0A, 28,         0x1A2B3C4D, 0x00000001,
+                           0xFFFFFFFF, 0xFFFFFFFF, 28};  // 1.0, 길이 미지정
+  writeBlock(shb, sizeof(shb));
+  const uint32_t snaplen =
+      static_cast<uint32_t>(8 + 2 * kMaxName + config_.snaplen);
+  const uint32_t idb[8] = {1, 32, kLinkType, snaplen,
+                           0x00010009,  // if_tsresol (code 9, len 1)
+                           9,           // 10^-9 초, 패딩 3바이트
+                           0,           // opt_endofopt
+                           32};
+  writeBlock(idb, sizeof(idb));
+}
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_FRAMECAPTURE_HPP
@@ -36,9 +36,14 @@
 #ifndef NEXUM_COM_EXTERNAL_FRAME_IFRAME_H
 #define NEXUM_COM_EXTERNAL_FRAME_IFRAME_H
 
+#include <algorithm>
 #include <any>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <future>
@@ -46,21 +51,57 @@
 #include <mutex>
 #include <queue>
 #include <shared_mutex>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "../executor/IExecutor.h"
+#include "../executor/Strand.hpp"
 #include "../method/IMethod.h"
+#include "SignalTable.hpp"
 
 /**
  * @brief 콜백 실행 정책(enum)
  * - Direct: 즉시 호출
  * - Threaded: 별도 스레드에서 호출
+ * - Executor: 공유 실행기(IExecutor)에서 호출 (구독별 순서 보장)
  */
-enum class CallbackPolicy { Direct, Threaded };
+enum class CallbackPolicy { Direct, Threaded, Executor };
+
+class IFrame;
+
+/**
+ * @brief 프레임 이벤트 종류 (캡처 탭 전달용)
+ * - Publish: notifyCallbacks로 구독자에게 알림
+ * - PortRx: 포트가 외부 데이터를 프레임에 기록
+ * - PortTx: 포트가 프레임 데이터를 외부로 내보냄
+ */
+enum class FrameEvent : uint8_t { Publish = 0, PortRx = 1, PortTx = 2 };
+
+/**
+ * @brief 프레임 이벤트 관찰자 인터페이스 (FrameCapture 등)
+ */
+class IFrameTap {
+ public:
+  virtual ~IFrameTap() = default;
+
+  /**
+   * @brief 이벤트 발생 시 발생 스레드에서 바로 호출 (짧게 처리해야 함)
+   * @param frame 대상 프레임
+   * @param event 이벤트 종류
+   * @param port 포트 이름 (Publish면 빈 문자열)
+   * @param payload 주고받은 바이트 (비어 있으면 frame에서 직접 읽음)
+   */
+  virtual void onFrameEvent(const IFrame& frame, FrameEvent event,
+                            std::string_view port,
+                            std::span<const std::byte> payload) noexcept = 0;
+};
 
 /**
  * @brief IFrame 인터페이스
@@ -98,6 +139,8 @@ class IFrame : public IMethod {
     CallbackPolicy policy;                       ///< 콜백 실행 정책
     struct ThreadedData;                         ///< Threaded 정책 시 사용
     std::unique_ptr<ThreadedData> threadedData;  ///< Threaded 정책 데이터
+    struct ExecutorData;                         ///< Executor 정책 시 사용
+    std::shared_ptr<ExecutorData> executorData;  ///< Executor 정책 데이터
     void stopAndJoin();
   };
 
@@ -120,6 +163,13 @@ class IFrame : public IMethod {
    * @return 프레임 식별자 문자열
    */
   virtual std::string id() const = 0;
+
+  /**
+   * @brief 할당 없는 프레임 ID (프레임 수명 동안 유효)
+   * @return ID를 보관하지 않는 구현은 빈 문자열 (id() 사용)
+   */
+  virtual std::string_view idView() const noexcept { return {}; }
+
   /**
    * @brief 프레임 데이터 크기 반환 (구현 필요)
    * @return 데이터 크기 (바이트)
@@ -134,10 +184,61 @@ class IFrame : public IMethod {
    * @param member 멤버 포인터
    * @param data_ptr 데이터 객체 포인터
    * @param rwlock 읽기/쓰기 락 포인터
+   * @param access 접근 방식. SignalAccess::Atomic은 자연 정렬된
+   *               1/2/4/8바이트 필드를 std::atomic_ref로 락 없이 읽고 씁니다.
+   *               (조건 불만족 시 std::logic_error)
    */
   template <typename T, typename Field>
   void registerSignal(const std::string& name, Field T::* member, T* data_ptr,
-                      std::shared_mutex* rwlock);
+                      std::shared_mutex* rwlock,
+                      SignalAccess access = SignalAccess::Locked);
+
+  /**
+   * @brief 신호 집합 고정 (완전 해시 조회 테이블 구성)
+   *
+   * 생성자에서 신호 등록을 마친 뒤 1회 호출합니다. FactoryRegistry로
+   * 생성되거나 FrameBus에 처음 등록되는 프레임은 자동으로 고정됩니다.
+   * 고정 이후 registerSignal은 std::logic_error를 던집니다.
+   */
+  void freezeSignals();
+
+  /**
+   * @brief 신호 디스크립터 조회
+   * @param name 신호명
+   * @return 디스크립터 포인터 (없으면 nullptr)
+   */
+  const SignalDescriptor* signalDescriptor(std::string_view name) const;
+
+  /**
+   * @brief 등록된 전체 신호 엔트리 (등록 순서)
+   */
+  std::span<const SignalTable::Entry> signalEntries() const;
+
+  /**
+   * @brief 데이터 버전 (쓰기가 완료될 때마다 1 증가)
+   * @note data()/rawData()로 얻은 참조를 통한 직접 수정은 반영되지 않습니다.
+   *       AtomicFrameBase는 쓰기가 아니라 notifyCallbacks(발행)마다
+   *       증가합니다.
+   */
+  uint64_t version() const {
+    return writesDone_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief 락 없는 버전 일관 읽기 1회 시도 (seqlock 방식, 쓰기를 막지 않음)
+   * @param out 복사 대상 (rawDataSize() 이상)
+   * @param version 성공 시 복사한 데이터의 버전
+   * @return 진행 중인 쓰기가 없고 복사 중 새 쓰기가 시작되지 않았으면 true
+   *         (락 없는 복사를 지원하지 않는 구현은 항상 false)
+   */
+  bool tryReadVersioned(std::span<std::byte> out, uint64_t& version) const;
+
+  /**
+   * @brief version 이후 새 쓰기가 시작되지 않았는지 확인
+   */
+  bool unchangedSince(uint64_t version) const {
+    return writesBegun_.load(std::memory_order_acquire) == version;
+  }
 
   /**
    * @brief 신호값 반환 (std::any)
@@ -167,18 +268,99 @@ class IFrame : public IMethod {
    */
   CallbackId addCallback(Callback cb,
                          CallbackPolicy policy = CallbackPolicy::Threaded);
+  /**
+   * @brief 스냅샷 콜백 등록 (Threaded 정책)
+   *
+   * 기본 콜백 실행기가 설정되어 있으면 전용 스레드 대신 해당 실행기에서
+   * 실행됩니다 (시뮬레이션 모드 등).
+   * @param cb 스냅샷 콜백
+   * @return 콜백 ID
+   */
   CallbackId addSnapshotCallback(SnapshotCallback cb);
+  /**
+   * @brief 실행기 기반 스냅샷 콜백 등록
+   *
+   * 전용 스레드 대신 공유 실행기에서 콜백을 실행합니다. 한 구독의
+   * 스냅샷은 Strand를 통해 순서대로, 한 번에 하나씩 전달됩니다.
+   * @param cb 스냅샷 콜백
+   * @param executor 실행기 (구독보다 오래 살아 있어야 함)
+   * @param attr 우선순위 / 마감 속성 (마감은 notify 시각 기준)
+   * @return 콜백 ID
+   */
+  CallbackId addSnapshotCallback(SnapshotCallback cb, IExecutor& executor,
+                                 DispatchAttr attr = {});
   /**
    * @brief 콜백 해제
    * @param id 콜백 ID
    */
   void removeCallback(CallbackId id);
 
+  /**
+   * @brief 프로세스 전역 기본 콜백 실행기 설정
+   *
+   * 설정 이후 등록되는 Threaded 스냅샷 콜백은 스레드를 만들지 않고
+   * 이 실행기에서 실행됩니다. nullptr이면 기본 동작으로 돌아갑니다.
+   * @param executor 실행기 (등록된 콜백보다 오래 살아 있어야 함)
+   */
+  static void setDefaultCallbackExecutor(IExecutor* executor);
+
+  /**
+   * @brief 현재 기본 콜백 실행기 (없으면 nullptr)
+   */
+  static IExecutor* defaultCallbackExecutor();
+
+  /**
+   * @brief 프로세스 전역 프레임 탭 설치 (nullptr이면 해제)
+   *
+   * 기다리지 않습니다. 진행 중인 호출은 각자 잡은 shared_ptr로 이전
+   * 탭을 유지하며, 마지막 호출이 끝날 때 이전 탭이 해제됩니다.
+   * @throws std::logic_error 탭 콜백(onFrameEvent) 안에서 호출할 때
+   */
+  static void setFrameTap(std::shared_ptr<IFrameTap> tap);
+
+  /**
+   * @brief 현재 프레임 탭 (없으면 nullptr, 소유권 없는 관찰용)
+   */
+  static IFrameTap* frameTap();
+
+  /**
+   * @brief 탭에 이벤트 전달 (탭이 없으면 relaxed load 1회로 끝남)
+   */
+  static void emitFrameEvent(const IFrame& frame, FrameEvent event,
+                             std::string_view port = {},
+                             std::span<const std::byte> payload = {});
+
   /**
    * @brief 콜백 전체 실행 (notify)
+   *
+   * 현재 스레드에 PublishBatch가 열려 있으면 프레임을 dirty로 표시만 하고,
+   * 배치가 끝날 때 최종 상태로 한 번 알립니다.
    */
   void notifyCallbacks();
 
+  /**
+   * @brief PublishBatch와 무관하게 즉시 콜백 실행
+   */
+  void notifyCallbacksNow();
+
+  /**
+   * @brief FrameBus 최초 등록 순번 (미등록이면 UINT64_MAX)
+   */
+  uint64_t busOrder() const {
+    return busOrder_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief 데이터 읽기 락 획득 (보유 동안 락 기반 쓰기 배제)
+   *
+   * 여러 프레임을 동시에 잡을 때는 항상 같은 순서(예: 주소 순)로
+   * 잡아야 합니다. 데이터 락이 없는 구현은 소유하지 않는 빈 락을
+   * 반환합니다.
+   */
+  virtual std::shared_lock<std::shared_mutex> lockShared() const {
+    return {};
+  }
+
   /**
    * @brief 람다 기반 원시 데이터 안전 접근
    */
@@ -207,9 +389,56 @@ class IFrame : public IMethod {
    */
   virtual void deserialize(const std::vector<uint8_t>& raw) = 0;
 
+  /**
+   * @brief 직렬화 결과의 최대 크기 (serializeInto 버퍼 크기 산정용)
+   * @return 바이트 수
+   */
+  virtual size_t serializedSize() const;
+  /**
+   * @brief 호출자 버퍼에 직접 직렬화 (할당 없음)
+   * @param out 출력 버퍼 (serializedSize() 이상 권장)
+   * @return 기록된 바이트 수
+   * @throws std::runtime_error 버퍼가 부족할 때
+   */
+  virtual size_t serializeInto(std::span<std::byte> out) const;
+  /**
+   * @brief 호출자 버퍼로부터 역직렬화 (콜백 없음, 할당 없음)
+   * @param raw 직렬화 데이터
+   */
+  virtual void deserializeFrom(std::span<const std::byte> raw);
+  /**
+   * @brief 호출자 버퍼로부터 역직렬화 후 콜백 알림
+   * @param raw 직렬화 데이터
+   * @return 성공 여부
+   */
+  virtual bool deserializeFromWithPublish(std::span<const std::byte> raw);
+
+  /**
+   * @brief 송신 부수효과 없는 직렬화 (콜백 스냅샷/캡처용)
+   *
+   * E2E 보호처럼 송신마다 상태가 바뀌는 처리를 건너뜁니다.
+   * 기본 구현은 serialize()와 같습니다.
+   * @return 직렬화 데이터
+   */
+  virtual std::vector<uint8_t> snapshot() const { return serialize(); }
+  /**
+   * @brief 송신 부수효과 없는 버퍼 직렬화 (snapshot()의 버퍼판)
+   * @param out 출력 버퍼
+   * @return 기록된 바이트 수
+   */
+  virtual size_t snapshotInto(std::span<std::byte> out) const {
+    return serializeInto(out);
+  }
+
  protected:
   std::unordered_map<std::string, Getter> getters_;  ///< Getter 함수 맵
   std::unordered_map<std::string, Setter> setters_;  ///< Setter 함수 맵
+  SignalTable signals_;                              ///< 신호 디스크립터 테이블
+  std::atomic<uint64_t> writesBegun_{0};  ///< 쓰기 시작 횟수
+  std::atomic<uint64_t> writesDone_{0};   ///< 쓰기 완료 횟수 (= 버전)
+  bool hasAtomicSignals_ = false;         ///< Atomic 신호 등록 여부
+  bool versionOnPublish_ = false;  ///< 쓰기 대신 발행마다 버전 갱신
+  std::atomic<uint64_t> busOrder_{UINT64_MAX};  ///< FrameBus 등록 순번
   std::vector<CallbackEntry> callbacks_;             ///< 콜백 리스트
   std::atomic<CallbackId> nextCallbackId_;           ///< 다음 콜백 ID
   std::mutex cb_mutex_;                              ///< 콜백 락
@@ -228,6 +457,123 @@ class IFrame : public IMethod {
   virtual char* rawData() { return nullptr; };
 
   virtual size_t rawDataSize() const { return 0; }  // 크기도 함께
+
+  /**
+   * @brief 락 없이 데이터 복사 (tryReadVersioned 전용, 검증은 호출자 몫)
+   * @return 지원하지 않거나 버퍼가 작으면 false
+   */
+  virtual bool copyRawUnlocked(std::span<std::byte> out) const {
+    (void)out;
+    return false;
+  }
+
+  /**
+   * @brief 쓰기 구간 표시 (시작/완료 카운터 증가, 버전 갱신)
+   *
+   * 데이터를 수정하는 모든 경로는 쓰기 동안 이 객체를 유지해야 합니다.
+   * 락 기반 쓰기는 데이터 락(unique)을 잡은 뒤 생성합니다.
+   * Atomic 신호가 없으면 쓰기가 락으로 직렬화되므로 RMW 대신 일반
+   * load/store로 카운터를 올립니다 (Atomic 신호 setter만 락 없이 경합).
+   */
+  class WriteScope {
+   public:
+    explicit WriteScope(IFrame& frame)
+        : frame_(frame), shared_(frame.hasAtomicSignals_) {
+      bump(frame_.writesBegun_, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+    }
+    ~WriteScope() { bump(frame_.writesDone_, std::memory_order_release); }
+    WriteScope(const WriteScope&) = delete;
+    WriteScope& operator=(const WriteScope&) = delete;
+
+   private:
+    void bump(std::atomic<uint64_t>& c, std::memory_order order) const {
+      if (shared_) {
+        c.fetch_add(1, order);
+      } else {
+        c.store(c.load(std::memory_order_relaxed) + 1, order);
+      }
+    }
+
+    IFrame& frame_;
+    const bool shared_;  ///< 락 없는 쓰기와 카운터를 공유하는지
+  };
+
+  /**
+   * @brief 완료된 쓰기 1건으로 버전 갱신 (쓰기 구간 없이)
+   *
+   * 데이터 자체가 원자 슬롯이라 seqlock 구간이 필요 없는 프레임
+   * (AtomicFrameBase)이 notifyCallbacks에서 발행 1회당 한 번 호출합니다.
+   */
+  void bumpVersion() {
+    writesBegun_.fetch_add(1, std::memory_order_relaxed);
+    writesDone_.fetch_add(1, std::memory_order_release);
+  }
+
+  /**
+   * @brief 신호 접근자 등록 (registerSignal 계열 공통 진입점)
+   * @param name 신호명
+   * @param desc 신호 디스크립터
+   * @param getter Getter 함수
+   * @param setter Setter 함수
+   */
+  void registerSignalAccessor(const std::string& name,
+                              const SignalDescriptor& desc, Getter getter,
+                              Setter setter);
+
+  /**
+   * @brief Atomic 신호 쓰기와 일관된 데이터 전체 복사 (버전 프로토콜)
+   *
+   * 쓰기 시작/완료 카운터가 같고 복사 전후로 변하지 않을 때까지 재시도합니다.
+   * 호출자는 데이터 RW 락(shared)을 보유해 락 기반 쓰기를 배제해야 합니다.
+   * @param dst 복사 대상
+   * @param src 프레임 데이터
+   * @param size 크기 (바이트)
+   */
+  void readConsistent(void* dst, const void* src, size_t size) const;
+
+  /**
+   * @brief 동시 쓰기와 겹칠 수 있는 복사 (seqlock 읽기 전용)
+   *
+   * 결과는 버전 검증 후에만 채택해야 합니다. 일반 memcpy는 쓰기와
+   * 겹치면 데이터 경합(UB)이므로 std::atomic_ref 워드/바이트 단위
+   * relaxed 로드로 복사합니다.
+   */
+  static void seqlockCopy(void* dst, const void* src, size_t size);
+
+  /**
+   * @brief 락 없는 Atomic 신호 쓰기와 겹칠 수 있는 저장
+   *
+   * seqlockCopy의 쓰기 쪽 짝입니다. 데이터 락을 가진 전체 쓰기도 Atomic
+   * 신호 setter(락 없음)와 같은 바이트를 동시에 쓸 수 있으므로, Atomic
+   * 신호가 있는 프레임은 이 함수로 atomic_ref 워드/바이트 저장을 합니다.
+   */
+  static void seqlockStore(void* dst, const void* src, size_t size);
+
+ private:
+  friend class FrameBus;
+  friend class PublishBatch;
+
+  /**
+   * @brief 스레드별 지연 publish 상태 (가장 바깥 PublishBatch가 소유)
+   */
+  struct PublishDeferral {
+    size_t depth = 0;                  ///< 열린 PublishBatch 중첩 수
+    std::vector<IFrame*> dirty;        ///< 처음 dirty가 된 순서
+    std::unordered_set<IFrame*> seen;  ///< dirty 중복 제거
+    uint64_t coalesced = 0;            ///< 합쳐진 publish 수
+    /// 진행 중인 flush의 알림 목록 (해제된 프레임은 nullptr로 표시)
+    std::vector<std::vector<IFrame*>*> flushing;
+  };
+
+  /// 이 프레임을 알림 대기로 가진 PublishBatch 항목 수 (모든 스레드)
+  std::atomic<uint32_t> deferredIn_{0};
+
+  static std::atomic<IExecutor*>& defaultExecutorSlot();
+  static PublishDeferral*& publishDeferral();
+  static std::atomic<IFrameTap*>& tapSlot();  ///< 빠른 경로용 관찰 포인터
+  static std::atomic<std::shared_ptr<IFrameTap>>& tapOwner();
+  static bool& inFrameTap();  ///< 현재 스레드가 탭 콜백 안인지
 };
 
 /**
@@ -241,6 +587,15 @@ struct IFrame::CallbackEntry::ThreadedData {
   std::atomic<bool> stop{false};
 };
 
+/**
+ * @brief Executor 콜백 데이터 구조체
+ */
+struct IFrame::CallbackEntry::ExecutorData {
+  std::shared_ptr<Strand> strand;  ///< 구독별 직렬 큐
+  SnapshotCallback cb;             ///< 스냅샷 콜백
+  DispatchAttr attr;               ///< 우선순위 / 마감 속성
+};
+
 // ------------------- IFrame 구현부 -------------------
 
 inline void IFrame::CallbackEntry::stopAndJoin() {
@@ -251,12 +606,37 @@ inline void IFrame::CallbackEntry::stopAndJoin() {
       threadedData->cv.notify_all();
     }
     if (threadedData->worker.joinable()) threadedData->worker.join();
+  } else if (policy == CallbackPolicy::Executor && executorData) {
+    executorData->strand->close();
   }
 }
 
 inline IFrame::IFrame() : nextCallbackId_(1) {}
 
-inline IFrame::~IFrame() { stopThreadedCallbacks(); }
+inline IFrame::~IFrame() {
+  // 현재 스레드의 배치에 남은 자신을 제거 (해제된 프레임 알림 방지)
+  uint32_t own = 0;
+  if (PublishDeferral* d = publishDeferral()) {
+    if (d->seen.erase(this)) {
+      std::erase(d->dirty, this);
+      ++own;
+    }
+    for (auto* list : d->flushing) {
+      own += static_cast<uint32_t>(
+          std::count(list->begin(), list->end(), this));
+      std::replace(list->begin(), list->end(), this,
+                   static_cast<IFrame*>(nullptr));
+    }
+  }
+  // 다른 스레드의 배치는 여기서 고칠 수 없음: 댕글링 대신 즉시 중단
+  if (deferredIn_.fetch_sub(own, std::memory_order_acq_rel) != own) {
+    std::fputs("IFrame: destroyed while another thread's PublishBatch "
+               "still holds it\n",
+               stderr);
+    std::abort();
+  }
+  stopThreadedCallbacks();
+}
 
 inline void IFrame::stopThreadedCallbacks() {
   std::unique_lock<std::mutex> lock(cb_mutex_);
@@ -267,18 +647,139 @@ inline void IFrame::stopThreadedCallbacks() {
 
 template <typename T, typename Field>
 inline void IFrame::registerSignal(const std::string& name, Field T::* member,
-                                   T* data_ptr, std::shared_mutex* rwlock) {
-  getters_[name] = [data_ptr, member, rwlock]() -> std::any {
-    std::shared_lock<std::shared_mutex> lock(*rwlock);
-    return data_ptr->*member;
+                                   T* data_ptr, std::shared_mutex* rwlock,
+                                   SignalAccess access) {
+  if (access == SignalAccess::Atomic) {
+    constexpr size_t n = sizeof(Field);
+    if constexpr ((n == 1 || n == 2 || n == 4 || n == 8) &&
+                  std::is_trivially_copyable_v<Field>) {
+      Field* field = &(data_ptr->*member);
+      if (reinterpret_cast<uintptr_t>(field) % n != 0)
+        throw std::logic_error("Atomic signal is not naturally aligned: " +
+                               name);
+      hasAtomicSignals_ = true;
+      registerSignalAccessor(
+          name, SignalDescriptor::of(member, data_ptr, access),
+          [field]() -> std::any {
+            return std::atomic_ref<Field>(*field).load(
+                std::memory_order_acquire);
+          },
+          [this, field](const std::any& v) {
+            const Field value = std::any_cast<Field>(v);
+            WriteScope scope(*this);
+            std::atomic_ref<Field>(*field).store(value,
+                                                 std::memory_order_relaxed);
+          });
+      return;
+    } else {
+      throw std::logic_error("Atomic signal must be a 1/2/4/8-byte field: " +
+                             name);
+    }
+  }
+  registerSignalAccessor(
+      name, SignalDescriptor::of(member, data_ptr),
+      [data_ptr, member, rwlock]() -> std::any {
+        std::shared_lock<std::shared_mutex> lock(*rwlock);
+        return data_ptr->*member;
+      },
+      [this, data_ptr, member, rwlock](const std::any& v) {
+        const Field value = std::any_cast<Field>(v);
+        std::unique_lock<std::shared_mutex> lock(*rwlock);
+        WriteScope scope(*this);
+        data_ptr->*member = value;
+      });
+}
+
+inline void IFrame::registerSignalAccessor(const std::string& name,
+                                           const SignalDescriptor& desc,
+                                           Getter getter, Setter setter) {
+  signals_.add(name, desc, getter, setter);
+  getters_[name] = std::move(getter);
+  setters_[name] = std::move(setter);
+}
+
+inline void IFrame::readConsistent(void* dst, const void* src,
+                                   size_t size) const {
+  for (;;) {
+    // done을 먼저 읽어야 begin == done일 때 진행 중인 쓰기가 없음이 보장됨
+    const uint64_t done = writesDone_.load(std::memory_order_acquire);
+    const uint64_t begun = writesBegun_.load(std::memory_order_acquire);
+    if (begun != done) {
+      std::this_thread::yield();
+      continue;
+    }
+    seqlockCopy(dst, src, size);  // seqlock 방식: 검증 실패 시 버림
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (writesBegun_.load(std::memory_order_relaxed) == begun) return;
+  }
+}
+
+inline void IFrame::seqlockCopy(void* dst, const void* src, size_t size) {
+  auto* d = static_cast<unsigned char*>(dst);
+  auto* s = static_cast<unsigned char*>(const_cast<void*>(src));
+  auto loadByte = [](unsigned char& b) {
+    return std::atomic_ref<unsigned char>(b).load(std::memory_order_relaxed);
   };
-  setters_[name] = [data_ptr, member, rwlock](const std::any& v) {
-    std::unique_lock<std::shared_mutex> lock(*rwlock);
-    data_ptr->*member = std::any_cast<Field>(v);
+  size_t i = 0;
+  for (; i < size && reinterpret_cast<uintptr_t>(s + i) % 8 != 0; ++i)
+    d[i] = loadByte(s[i]);
+  for (; i + 8 <= size; i += 8) {
+    const uint64_t w = std::atomic_ref<uint64_t>(
+                           *reinterpret_cast<uint64_t*>(s + i))
+                           .load(std::memory_order_relaxed);
+    std::memcpy(d + i, &w, 8);
+  }
+  for (; i < size; ++i) d[i] = loadByte(s[i]);
+}
+
+inline void IFrame::seqlockStore(void* dst, const void* src, size_t size) {
+  auto* d = static_cast<unsigned char*>(dst);
+  const auto* s = static_cast<const unsigned char*>(src);
+  auto storeByte = [](unsigned char& b, unsigned char v) {
+    std::atomic_ref<unsigned char>(b).store(v, std::memory_order_relaxed);
   };
+  size_t i = 0;
+  for (; i < size && reinterpret_cast<uintptr_t>(d + i) % 8 != 0; ++i)
+    storeByte(d[i], s[i]);
+  for (; i + 8 <= size; i += 8) {
+    uint64_t w;
+    std::memcpy(&w, s + i, 8);
+    std::atomic_ref<uint64_t>(*reinterpret_cast<uint64_t*>(d + i))
+        .store(w, std::memory_order_relaxed);
+  }
+  for (; i < size; ++i) storeByte(d[i], s[i]);
+}
+
+inline bool IFrame::tryReadVersioned(std::span<std::byte> out,
+                                     uint64_t& version) const {
+  const uint64_t done = writesDone_.load(std::memory_order_acquire);
+  const uint64_t begun = writesBegun_.load(std::memory_order_acquire);
+  if (begun != done) return false;
+  if (!copyRawUnlocked(out)) return false;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (writesBegun_.load(std::memory_order_relaxed) != begun) return false;
+  version = done;
+  return true;
+}
+
+inline void IFrame::freezeSignals() { signals_.freeze(); }
+
+inline const SignalDescriptor* IFrame::signalDescriptor(
+    std::string_view name) const {
+  const auto* e = signals_.find(name);
+  return e ? &e->desc : nullptr;
+}
+
+inline std::span<const SignalTable::Entry> IFrame::signalEntries() const {
+  return signals_.entries();
 }
 
 inline std::any IFrame::getSignal(const std::string& name) const {
+  if (signals_.frozen()) {
+    const auto* e = signals_.find(name);
+    if (!e) throw std::runtime_error("Unknown signal: " + name);
+    return e->getter();
+  }
   auto it = getters_.find(name);
   if (it == getters_.end()) throw std::runtime_error("Unknown signal: " + name);
   return it->second();
@@ -286,18 +787,84 @@ inline std::any IFrame::getSignal(const std::string& name) const {
 
 inline void IFrame::setSignalWithPublish(const std::string& name,
                                          const std::any& value) {
-  auto it = setters_.find(name);
-  if (it == setters_.end()) throw std::runtime_error("Unknown signal: " + name);
-  it->second(value);
+  IFrame::setSignal(name, value);
   notifyCallbacks();
 }
 
 inline void IFrame::setSignal(const std::string& name, const std::any& value) {
+  if (signals_.frozen()) {
+    const auto* e = signals_.find(name);
+    if (!e) throw std::runtime_error("Unknown signal: " + name);
+    e->setter(value);
+    return;
+  }
   auto it = setters_.find(name);
   if (it == setters_.end()) throw std::runtime_error("Unknown signal: " + name);
   it->second(value);
 }
 
+inline void IFrame::setDefaultCallbackExecutor(IExecutor* executor) {
+  defaultExecutorSlot().store(executor, std::memory_order_release);
+}
+
+inline IExecutor* IFrame::defaultCallbackExecutor() {
+  return defaultExecutorSlot().load(std::memory_order_acquire);
+}
+
+inline std::atomic<IExecutor*>& IFrame::defaultExecutorSlot() {
+  static std::atomic<IExecutor*> slot{nullptr};  // 모든 번역 단위가 공유
+  return slot;
+}
+
+inline std::atomic<IFrameTap*>& IFrame::tapSlot() {
+  static std::atomic<IFrameTap*> slot{nullptr};
+  return slot;
+}
+
+inline std::atomic<std::shared_ptr<IFrameTap>>& IFrame::tapOwner() {
+  static std::atomic<std::shared_ptr<IFrameTap>> owner;
+  return owner;
+}
+
+inline bool& IFrame::inFrameTap() {
+  thread_local bool inside = false;
+  return inside;
+}
+
+inline void IFrame::setFrameTap(std::shared_ptr<IFrameTap> tap) {
+  if (inFrameTap())
+    throw std::logic_error("IFrame: setFrameTap called from onFrameEvent");
+  static std::mutex setMutex;  // 소유 포인터와 관찰 포인터를 같이 교체
+  std::lock_guard<std::mutex> lock(setMutex);
+  IFrameTap* raw = tap.get();
+  tapOwner().store(std::move(tap), std::memory_order_release);
+  tapSlot().store(raw, std::memory_order_release);
+}
+
+inline IFrameTap* IFrame::frameTap() {
+  return tapSlot().load(std::memory_order_acquire);
+}
+
+inline void IFrame::emitFrameEvent(const IFrame& frame, FrameEvent event,
+                                   std::string_view port,
+                                   std::span<const std::byte> payload) {
+  if (!tapSlot().load(std::memory_order_relaxed)) return;  // 빠른 경로
+  // 호출 동안 탭을 붙잡아 두므로 도중에 교체되어도 해제되지 않음
+  const std::shared_ptr<IFrameTap> tap =
+      tapOwner().load(std::memory_order_acquire);
+  if (!tap) return;
+  bool& inside = inFrameTap();
+  const bool outer = !inside;
+  inside = true;
+  tap->onFrameEvent(frame, event, port, payload);  // noexcept
+  if (outer) inside = false;
+}
+
+inline IFrame::PublishDeferral*& IFrame::publishDeferral() {
+  thread_local PublishDeferral* current = nullptr;  // 배치 밖에서는 nullptr
+  return current;
+}
+
 /**
  * @brief Direct 모드 콜백 등록
  */
@@ -308,7 +875,7 @@ inline IFrame::CallbackId IFrame::addCallback(Callback cb,
   if (policy == CallbackPolicy::Threaded) {
     throw std::logic_error("Use addSnapshotCallback for Threaded policy");
   }
-  callbacks_.push_back({id, std::move(cb), nullptr, policy, nullptr});
+  callbacks_.push_back({id, std::move(cb), nullptr, policy, nullptr, nullptr});
   return id;
 }
 
@@ -316,6 +883,8 @@ inline IFrame::CallbackId IFrame::addCallback(Callback cb,
  * @brief Threaded 모드 콜백 등록 (스냅샷 기반)
  */
 inline IFrame::CallbackId IFrame::addSnapshotCallback(SnapshotCallback cb) {
+  if (IExecutor* executor = defaultCallbackExecutor())
+    return addSnapshotCallback(std::move(cb), *executor);
   CallbackId id = nextCallbackId_.fetch_add(1);
   std::unique_lock<std::mutex> lock(cb_mutex_);
 
@@ -341,14 +910,45 @@ inline IFrame::CallbackId IFrame::addSnapshotCallback(SnapshotCallback cb) {
     }
   });
   callbacks_.push_back({id, nullptr, std::move(cb), CallbackPolicy::Threaded,
-                        std::move(threaded)});
+                        std::move(threaded), nullptr});
+  return id;
+}
+
+/**
+ * @brief Executor 모드 콜백 등록 (스냅샷 기반)
+ */
+inline IFrame::CallbackId IFrame::addSnapshotCallback(SnapshotCallback cb,
+                                                      IExecutor& executor,
+                                                      DispatchAttr attr) {
+  CallbackId id = nextCallbackId_.fetch_add(1);
+  std::unique_lock<std::mutex> lock(cb_mutex_);
+  auto data = std::make_shared<CallbackEntry::ExecutorData>();
+  data->strand = std::make_shared<Strand>(executor);
+  executor.attachStrand(data->strand);
+  data->cb = cb;
+  data->attr = attr;
+  callbacks_.push_back({id, nullptr, std::move(cb), CallbackPolicy::Executor,
+                        nullptr, std::move(data)});
   return id;
 }
 
 /**
- * @brief 콜백 전체 실행 (notify)
+ * @brief 콜백 전체 실행 (notify, PublishBatch 중이면 지연)
  */
 inline void IFrame::notifyCallbacks() {
+  if (versionOnPublish_) bumpVersion();
+  PublishDeferral* d = publishDeferral();
+  if (!d) return notifyCallbacksNow();
+  if (d->seen.insert(this).second) {
+    d->dirty.push_back(this);
+    deferredIn_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    ++d->coalesced;
+  }
+}
+
+inline void IFrame::notifyCallbacksNow() {
+  emitFrameEvent(*this, FrameEvent::Publish);
   std::unique_lock<std::mutex> lock(cb_mutex_);
   for (auto& entry : callbacks_) {
     if (entry.policy == CallbackPolicy::Direct && entry.cb) {
@@ -356,16 +956,47 @@ inline void IFrame::notifyCallbacks() {
     } else if (entry.policy == CallbackPolicy::Threaded && entry.snapshotCb &&
                entry.threadedData) {
       // 콜백 호출 시점의 snapshot을 큐에 push
-      std::vector<uint8_t> snapshot = this->serialize();
+      std::vector<uint8_t> snapshot = this->snapshot();
       {
         std::lock_guard<std::mutex> qlock(entry.threadedData->mtx);
         entry.threadedData->queue.push(std::move(snapshot));
         entry.threadedData->cv.notify_one();
       }
+    } else if (entry.policy == CallbackPolicy::Executor &&
+               entry.executorData) {
+      auto data = entry.executorData;
+      data->strand->post(
+          [data, snapshot = this->snapshot()] {
+            if (!snapshot.empty()) data->cb(snapshot, snapshot.size());
+          },
+          data->attr);
     }
   }
 }
 
+// 기본 구현은 vector 기반 API로 위임 (FrameBase는 할당 없는 경로로 재정의)
+inline size_t IFrame::serializedSize() const { return serialize().size(); }
+
+inline size_t IFrame::serializeInto(std::span<std::byte> out) const {
+  std::vector<uint8_t> buf = serialize();
+  if (buf.size() > out.size())
+    throw std::runtime_error("IFrame: serializeInto buffer too small: need " +
+                             std::to_string(buf.size()) + ", got " +
+                             std::to_string(out.size()));
+  std::memcpy(out.data(), buf.data(), buf.size());
+  return buf.size();
+}
+
+inline void IFrame::deserializeFrom(std::span<const std::byte> raw) {
+  const auto* p = reinterpret_cast<const uint8_t*>(raw.data());
+  deserialize(std::vector<uint8_t>(p, p + raw.size()));
+}
+
+inline bool IFrame::deserializeFromWithPublish(std::span<const std::byte> raw) {
+  const auto* p = reinterpret_cast<const uint8_t*>(raw.data());
+  return deserializeWithPublish(std::vector<uint8_t>(p, p + raw.size()));
+}
+
 inline void IFrame::removeCallback(CallbackId id) {
   std::unique_lock<std::mutex> lock(cb_mutex_);
   for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
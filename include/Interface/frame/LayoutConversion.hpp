@@ -0,0 +1,436 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_LAYOUTCONVERSION_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_LAYOUTCONVERSION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "SignalTable.hpp"
+
+/**
+ * @brief 데이터 구조체 레이아웃 (버전 + 필드 목록)
+ *
+ * 필드는 신호와 같은 디스크립터(오프셋/크기/타입)로 기술하며, 버전 간
+ * 대응은 필드 이름으로 찾습니다. 현재 레이아웃은 프레임에 등록된 신호로,
+ * 이전 레이아웃은 옛 구조체 정의나 스키마 파일로부터 만듭니다.
+ */
+class FrameLayout {
+ public:
+  static constexpr size_t kNoVersionField = SIZE_MAX;  ///< 버전 필드 없음
+
+  /**
+   * @brief 레이아웃 필드
+   */
+  struct Field {
+    std::string name;       ///< 필드(신호)명
+    SignalDescriptor desc;  ///< 위치/크기/타입
+  };
+
+  /**
+   * @brief 생성자
+   * @param version 레이아웃 버전
+   * @param size 구조체 크기 (바이트)
+   */
+  FrameLayout(uint16_t version, size_t size) : version_(version), size_(size) {}
+
+  /**
+   * @brief 구조체 타입으로부터 빈 레이아웃 생성
+   * @tparam T 해당 버전의 데이터 구조체
+   */
+  template <typename T>
+  static FrameLayout of(uint16_t version) {
+    return FrameLayout(version, sizeof(T));
+  }
+
+  /**
+   * @brief 신호 엔트리로부터 레이아웃 생성 (프레임의 현재 레이아웃)
+   */
+  static FrameLayout fromSignals(uint16_t version, size_t size,
+                                 std::span<const SignalTable::Entry> entries) {
+    FrameLayout l(version, size);
+    for (const auto& e : entries) l.field(e.name, e.desc);
+    return l;
+  }
+
+  /**
+   * @brief 멤버 포인터로 필드 추가
+   */
+  template <typename T, typename F>
+  FrameLayout& field(const std::string& name, F T::* member) {
+    static const T probe{};  // 주소 계산용
+    return field(name, SignalDescriptor::of(member, &probe));
+  }
+
+  /**
+   * @brief 디스크립터로 필드 추가
+   * @throws std::invalid_argument 구조체 범위를 벗어나는 경우
+   */
+  FrameLayout& field(const std::string& name, const SignalDescriptor& desc) {
+    if (desc.offset > size_ || size_ - desc.offset < desc.size)
+      throw std::invalid_argument("FrameLayout: field out of range: " + name);
+    fields_.push_back({name, desc});
+    return *this;
+  }
+
+  uint16_t version() const { return version_; }
+  size_t size() const { return size_; }
+  const std::vector<Field>& fields() const { return fields_; }
+
+  /**
+   * @brief 이름으로 필드 조회
+   * @return 필드 포인터 (없으면 nullptr)
+   */
+  const Field* find(const std::string& name) const {
+    for (const auto& f : fields_)
+      if (f.name == name) return &f;
+    return nullptr;
+  }
+
+ private:
+  uint16_t version_;           ///< 레이아웃 버전
+  size_t size_;                ///< 구조체 크기
+  std::vector<Field> fields_;  ///< 필드 목록
+};
+
+/**
+ * @brief 두 레이아웃 사이의 미리 컴파일된 변환 프로그램
+ *
+ * 필드 이름으로 대응시켜 다음 규칙으로 명령 목록을 만듭니다.
+ * - 타입/원소 크기가 같으면 복사 (원소 개수가 다르면 앞쪽 공통 부분만)
+ * - 둘 다 숫자 스칼라 타입이면 원소별 변환 (정수 폭/부호, 정수<->실수)
+ *   실수→정수는 대상 범위로 포화시키고 NaN은 0으로 저장합니다.
+ *   double→float은 유한값을 float 범위로 포화시킵니다 (무한대/NaN 유지).
+ *   bool 원본은 0이 아닌 바이트를 true로 읽습니다.
+ * - 원본에 없거나 변환할 수 없는 필드, 신호가 아닌 바이트는 기본값 유지
+ * - 대상에 없는 원본 필드는 버림
+ *
+ * 오프셋이 이어지는 복사는 하나로 합쳐지므로, 필드 추가만 있는 경우
+ * 실행 비용은 memcpy 몇 번입니다. 실행은 상태가 없어 동시에 호출해도
+ * 안전합니다.
+ */
+class LayoutProgram {
+ public:
+  /**
+   * @brief 컴파일 결과 요약
+   */
+  struct Summary {
+    size_t copied = 0;     ///< 복사한 필드 수
+    size_t converted = 0;  ///< 타입 변환한 필드 수
+    size_t defaulted = 0;  ///< 기본값을 쓰는 대상 필드 수
+    size_t dropped = 0;    ///< 버린 원본 필드 수
+    size_t copyRuns = 0;   ///< 병합 후 복사 명령 수
+  };
+
+  /**
+   * @brief 변환 프로그램 컴파일
+   * @param from 원본 레이아웃
+   * @param to 대상 레이아웃
+   * @param defaults 대상 레이아웃 크기의 기본값 바이트
+   * @throws std::invalid_argument defaults 크기가 대상과 다른 경우
+   */
+  LayoutProgram(const FrameLayout& from, const FrameLayout& to,
+                std::span<const std::byte> defaults)
+      : fromVersion_(from.version()),
+        toVersion_(to.version()),
+        fromSize_(from.size()),
+        toSize_(to.size()),
+        defaults_(defaults.begin(), defaults.end()) {
+    if (defaults.size() != to.size())
+      throw std::invalid_argument("LayoutProgram: defaults size mismatch");
+    std::vector<Copy> copies;
+    for (const auto& d : to.fields()) {
+      const FrameLayout::Field* s = from.find(d.name);
+      if (!s || !compileField(s->desc, d.desc, copies)) ++summary_.defaulted;
+    }
+    for (const auto& s : from.fields())
+      if (!to.find(s.name)) ++summary_.dropped;
+    mergeCopies(copies);
+    markCoverage();
+  }
+
+  uint16_t fromVersion() const { return fromVersion_; }
+  uint16_t toVersion() const { return toVersion_; }
+  size_t fromSize() const { return fromSize_; }
+  size_t toSize() const { return toSize_; }
+  const Summary& summary() const { return summary_; }
+
+  /**
+   * @brief 변환 실행
+   * @param src 원본 레이아웃 데이터 (fromSize() 바이트)
+   * @param dst 대상 버퍼 (toSize() 바이트, src와 겹치면 안 됨)
+   * @throws std::runtime_error 크기가 맞지 않는 경우
+   */
+  void run(std::span<const std::byte> src, std::span<std::byte> dst) const {
+    if (src.size() != fromSize_ || dst.size() < toSize_)
+      throw std::runtime_error(
+          "LayoutProgram: size mismatch: got " + std::to_string(src.size()) +
+          ", expected " + std::to_string(fromSize_));
+    std::byte* out = dst.data();
+    const std::byte* in = src.data();
+    if (!fullyCovered_) std::memcpy(out, defaults_.data(), toSize_);
+    for (const auto& c : copies_) std::memcpy(out + c.dst, in + c.src, c.len);
+    for (const auto& c : converts_) {
+      for (uint32_t i = 0; i < c.count; ++i)
+        convertScalar(c.from, in + c.src + i * c.srcStride, c.to,
+                      out + c.dst + i * c.dstStride);
+    }
+  }
+
+ private:
+  struct Copy {
+    uint32_t src;  ///< 원본 오프셋
+    uint32_t dst;  ///< 대상 오프셋
+    uint32_t len;  ///< 길이
+  };
+
+  struct Convert {
+    SignalType from;     ///< 원본 원소 타입
+    SignalType to;       ///< 대상 원소 타입
+    uint32_t src;        ///< 원본 오프셋
+    uint32_t dst;        ///< 대상 오프셋
+    uint32_t srcStride;  ///< 원본 원소 크기
+    uint32_t dstStride;  ///< 대상 원소 크기
+    uint32_t count;      ///< 원소 개수
+  };
+
+  static bool isNumeric(SignalType t) { return t != SignalType::Bytes; }
+
+  static bool isFloating(SignalType t) {
+    return t == SignalType::Float || t == SignalType::Double;
+  }
+
+  static bool isSigned(SignalType t) {
+    return t == SignalType::Int8 || t == SignalType::Int16 ||
+           t == SignalType::Int32 || t == SignalType::Int64;
+  }
+
+  bool compileField(const SignalDescriptor& s, const SignalDescriptor& d,
+                    std::vector<Copy>& copies) {
+    uint32_t sElem = s.size / s.count;
+    uint32_t dElem = d.size / d.count;
+    uint32_t n = std::min(s.count, d.count);
+    if (s.type == d.type && sElem == dElem) {
+      copies.push_back({s.offset, d.offset, n * sElem});
+      if (n < d.count) ++summary_.defaulted;  // 뒤쪽 원소는 기본값
+      ++summary_.copied;
+      return true;
+    }
+    if (!isNumeric(s.type) || !isNumeric(d.type)) return false;
+    converts_.push_back({s.type, d.type, s.offset, d.offset, sElem, dElem, n});
+    ++summary_.converted;
+    return true;
+  }
+
+  void mergeCopies(std::vector<Copy>& copies) {
+    std::sort(copies.begin(), copies.end(),
+              [](const Copy& a, const Copy& b) { return a.dst < b.dst; });
+    for (const auto& c : copies) {
+      if (c.len == 0) continue;
+      if (!copies_.empty()) {
+        Copy& last = copies_.back();
+        if (last.src + last.len == c.src && last.dst + last.len == c.dst) {
+          last.len += c.len;
+          continue;
+        }
+      }
+      copies_.push_back(c);
+    }
+    summary_.copyRuns = copies_.size();
+  }
+
+  // 명령이 대상 전체를 덮으면 기본값 복사 생략
+  void markCoverage() {
+    std::vector<bool> covered(toSize_, false);
+    for (const auto& c : copies_)
+      std::fill_n(covered.begin() + c.dst, c.len, true);
+    for (const auto& c : converts_)
+      std::fill_n(covered.begin() + c.dst, c.count * c.dstStride, true);
+    fullyCovered_ = std::all_of(covered.begin(), covered.end(),
+                                [](bool b) { return b; });
+  }
+
+  template <typename T>
+  static T load(const std::byte* p) {
+    T v;
+    std::memcpy(&v, p, sizeof(T));
+    return v;
+  }
+
+  template <typename T>
+  static void store(std::byte* p, T v) {
+    std::memcpy(p, &v, sizeof(T));
+  }
+
+  static void convertScalar(SignalType from, const std::byte* in,
+                            SignalType to, std::byte* out) {
+    if (isFloating(from) || isFloating(to)) {
+      double v = loadAs<double>(from, in);
+      storeAs(to, out, v);
+    } else if (isSigned(from)) {
+      storeAs(to, out, loadAs<int64_t>(from, in));
+    } else {
+      storeAs(to, out, loadAs<uint64_t>(from, in));
+    }
+  }
+
+  template <typename V>
+  static V loadAs(SignalType t, const std::byte* p) {
+    switch (t) {
+      case SignalType::Bool:
+        return static_cast<V>(loadBool(p));
+      case SignalType::Int8:
+        return static_cast<V>(load<int8_t>(p));
+      case SignalType::UInt8:
+        return static_cast<V>(load<uint8_t>(p));
+      case SignalType::Int16:
+        return static_cast<V>(load<int16_t>(p));
+      case SignalType::UInt16:
+        return static_cast<V>(load<uint16_t>(p));
+      case SignalType::Int32:
+        return static_cast<V>(load<int32_t>(p));
+      case SignalType::UInt32:
+        return static_cast<V>(load<uint32_t>(p));
+      case SignalType::Int64:
+        return static_cast<V>(load<int64_t>(p));
+      case SignalType::UInt64:
+        return static_cast<V>(load<uint64_t>(p));
+      case SignalType::Float:
+        return static_cast<V>(load<float>(p));
+      case SignalType::Double:
+        return static_cast<V>(load<double>(p));
+      default:
+        return V{};
+    }
+  }
+
+  /**
+   * @brief bool 읽기 (0/1이 아닌 바이트를 bool로 memcpy하면 UB이므로
+   *        바이트 단위로 0 여부만 봅니다)
+   */
+  static bool loadBool(const std::byte* p) {
+    for (size_t i = 0; i < sizeof(bool); ++i)
+      if (p[i] != std::byte{0}) return true;
+    return false;
+  }
+
+  /**
+   * @brief float 변환 (범위를 벗어난 유한 실수는 ±FLT_MAX로 포화)
+   *
+   * float 범위 밖의 유한값을 static_cast하면 UB입니다. 무한대와 NaN은
+   * float로 그대로 표현되므로 변환합니다.
+   */
+  template <typename V>
+  static float toFloat(V v) {
+    if constexpr (std::is_floating_point_v<V>) {
+      using L = std::numeric_limits<float>;
+      if (std::isfinite(v)) {
+        if (v > static_cast<V>(L::max())) return L::max();
+        if (v < static_cast<V>(L::lowest())) return L::lowest();
+      }
+    }
+    return static_cast<float>(v);
+  }
+
+  /**
+   * @brief 정수 변환 (정수 원본은 모듈러, 실수 원본은 포화 / NaN → 0)
+   *
+   * 범위를 벗어난 실수의 static_cast는 UB이므로 먼저 경계와 비교합니다.
+   * 경계값은 I의 최소/최대를 V로 올림한 값이므로 비교 후 변환은 항상
+   * 범위 안입니다.
+   */
+  template <typename I, typename V>
+  static I toInteger(V v) {
+    if constexpr (std::is_floating_point_v<V>) {
+      using L = std::numeric_limits<I>;
+      if (std::isnan(v)) return 0;
+      if (v <= static_cast<V>(L::min())) return L::min();
+      if (v >= static_cast<V>(L::max())) return L::max();
+    }
+    return static_cast<I>(v);
+  }
+
+  template <typename V>
+  static void storeAs(SignalType t, std::byte* p, V v) {
+    switch (t) {
+      case SignalType::Bool:
+        return store<bool>(p, v != V{});
+      case SignalType::Int8:
+        return store(p, toInteger<int8_t>(v));
+      case SignalType::UInt8:
+        return store(p, toInteger<uint8_t>(v));
+      case SignalType::Int16:
+        return store(p, toInteger<int16_t>(v));
+      case SignalType::UInt16:
+        return store(p, toInteger<uint16_t>(v));
+      case SignalType::Int32:
+        return store(p, toInteger<int32_t>(v));
+      case SignalType::UInt32:
+        return store(p, toInteger<uint32_t>(v));
+      case SignalType::Int64:
+        return store(p, toInteger<int64_t>(v));
+      case SignalType::UInt64:
+        return store(p, toInteger<uint64_t>(v));
+      case SignalType::Float:
+        return store(p, toFloat(v));
+      case SignalType::Double:
+        return store(p, static_cast<double>(v));
+      default:
+        return;
+    }
+  }
+
+  uint16_t fromVersion_;            ///< 원본 버전
+  uint16_t toVersion_;              ///< 대상 버전
+  size_t fromSize_;                 ///< 원본 크기
+  size_t toSize_;                   ///< 대상 크기
+  std::vector<std::byte> defaults_;  ///< 대상 기본값
+  std::vector<Copy> copies_;        ///< 병합된 복사 명령
+  std::vector<Convert> converts_;   ///< 변환 명령
+  bool fullyCovered_ = false;       ///< 기본값 복사 생략 가능 여부
+  Summary summary_;                 ///< 컴파일 요약
+};
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_LAYOUTCONVERSION_HPP
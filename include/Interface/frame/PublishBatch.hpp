@@ -0,0 +1,202 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_PUBLISHBATCH_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_PUBLISHBATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IFrame.h"
+
+/**
+ * @brief 지연 publish 범위 (RAII)
+ *
+ * 범위 안에서 현재 스레드가 호출한 notifyCallbacks는 프레임을 dirty로
+ * 표시만 하고, 가장 바깥 범위가 끝날 때 dirty 프레임마다 최종 상태로
+ * 정확히 한 번 알립니다. 알림 순서는 FrameBus 등록 순서이며,
+ * 버스에 없는 프레임은 처음 dirty가 된 순서로 마지막에 처리됩니다.
+ *
+ * 알림 중 Direct 콜백이 다시 publish한 프레임도 같은 flush 안에서
+ * 이어서 처리되며, kMaxFlushRounds 라운드 안에 끝나지 않으면(콜백이
+ * 서로를 계속 다시 publish하는 경우) 남은 알림을 버리고 예외를 던집니다.
+ * 범위는 스레드 단위이며 중첩할 수 있습니다.
+ *
+ * @code
+ * {
+ *   PublishBatch batch;
+ *   port.setSignalToFrameWithPublish("Status", "speed", 10);
+ *   port.setSignalToFrameWithPublish("Status", "gear", 3);
+ * }  // "Status" 콜백 1회
+ * @endcode
+ *
+ * @note 대기 중인 프레임은 flush 전까지 살아 있어야 합니다.
+ *       현재 스레드에서 해제된 프레임(flush 중 콜백이 해제한 경우 포함)은
+ *       자동으로 제외됩니다. 프레임은 자신을 대기 중인 배치 수를 세며,
+ *       다른 스레드의 배치가 대기 중인 프레임을 해제하면 댕글링 포인터
+ *       대신 std::abort로 즉시 중단합니다.
+ */
+class PublishBatch {
+ public:
+  /// 한 flush에서 다시 publish된 프레임을 처리하는 최대 라운드 수
+  static constexpr size_t kMaxFlushRounds = 16;
+
+  PublishBatch() {
+    IFrame::PublishDeferral*& current = IFrame::publishDeferral();
+    if (current) {
+      ++current->depth;
+    } else {
+      state_.depth = 1;
+      current = &state_;
+      owner_ = true;
+    }
+  }
+
+  /**
+   * @brief 가장 바깥 범위면 대기 알림 전달 (콜백 예외는 무시됨)
+   *
+   * 예외를 받아야 하면 범위를 닫기 전에 flush()를 호출하십시오.
+   */
+  ~PublishBatch() {
+    IFrame::PublishDeferral*& current = IFrame::publishDeferral();
+    if (!owner_) {
+      --current->depth;
+      return;
+    }
+    try {
+      flush();
+    } catch (...) {
+    }
+    current = nullptr;
+  }
+
+  PublishBatch(const PublishBatch&) = delete;
+  PublishBatch& operator=(const PublishBatch&) = delete;
+
+  /**
+   * @brief 현재 스레드의 대기 알림을 즉시 전달 (범위는 유지)
+   *
+   * 한 콜백이 예외를 던져도 나머지 프레임은 모두 알린 뒤,
+   * 첫 번째 예외를 다시 던집니다.
+   * @throws std::runtime_error kMaxFlushRounds 안에 dirty가 비지 않을 때
+   *         (남은 알림은 버림)
+   */
+  static void flush() {
+    IFrame::PublishDeferral* d = IFrame::publishDeferral();
+    if (!d) return;
+    std::exception_ptr first;
+    std::vector<IFrame*> frames;
+    d->flushing.push_back(&frames);
+    struct Unlink {
+      IFrame::PublishDeferral* d;
+      ~Unlink() { d->flushing.pop_back(); }
+    } unlink{d};  // 콜백이 프레임을 해제하면 ~IFrame이 frames를 갱신
+    for (size_t round = 0; !d->dirty.empty(); ++round) {
+      if (round == kMaxFlushRounds) {
+        discard();
+        if (!first)
+          first = std::make_exception_ptr(std::runtime_error(
+              "PublishBatch: re-publish did not settle within " +
+              std::to_string(kMaxFlushRounds) + " rounds"));
+        break;
+      }
+      frames.swap(d->dirty);
+      d->dirty.clear();
+      d->seen.clear();
+      std::stable_sort(frames.begin(), frames.end(),
+                       [](const IFrame* a, const IFrame* b) {
+                         return a->busOrder() < b->busOrder();
+                       });
+      for (size_t i = 0; i < frames.size(); ++i) {
+        if (!frames[i]) continue;  // 이 flush 중에 해제됨
+        try {
+          frames[i]->notifyCallbacksNow();
+        } catch (...) {
+          if (!first) first = std::current_exception();
+        }
+        if (IFrame* f = frames[i]) {  // 콜백이 해제했으면 ~IFrame이 정리
+          f->deferredIn_.fetch_sub(1, std::memory_order_release);
+          frames[i] = nullptr;
+        }
+      }
+    }
+    if (first) std::rethrow_exception(first);
+  }
+
+  /**
+   * @brief 현재 스레드의 대기 알림을 전달하지 않고 버림
+   */
+  static void discard() {
+    if (IFrame::PublishDeferral* d = IFrame::publishDeferral()) {
+      for (IFrame* f : d->dirty)
+        f->deferredIn_.fetch_sub(1, std::memory_order_release);
+      d->dirty.clear();
+      d->seen.clear();
+    }
+  }
+
+  /**
+   * @brief 현재 스레드에 열린 배치가 있는지
+   */
+  static bool active() { return IFrame::publishDeferral() != nullptr; }
+
+  /**
+   * @brief 현재 스레드에서 알림을 기다리는 프레임 수
+   */
+  static size_t pending() {
+    const IFrame::PublishDeferral* d = IFrame::publishDeferral();
+    return d ? d->dirty.size() : 0;
+  }
+
+  /**
+   * @brief 현재 배치에서 이미 dirty인 프레임에 합쳐진 publish 수
+   */
+  static uint64_t coalesced() {
+    const IFrame::PublishDeferral* d = IFrame::publishDeferral();
+    return d ? d->coalesced : 0;
+  }
+
+ private:
+  IFrame::PublishDeferral state_;  ///< 가장 바깥 범위가 소유하는 상태
+  bool owner_ = false;             ///< 가장 바깥 범위 여부
+};
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_PUBLISHBATCH_HPP
@@ -0,0 +1,387 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_SIGNALTABLE_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_SIGNALTABLE_HPP
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief 신호 값 타입 태그
+ */
+enum class SignalType : uint8_t {
+  Bool,
+  Int8,
+  UInt8,
+  Int16,
+  UInt16,
+  Int32,
+  UInt32,
+  Int64,
+  UInt64,
+  Float,
+  Double,
+  Bytes  ///< 그 외 TriviallyCopyable 타입 (구조체 등)
+};
+
+/**
+ * @brief 신호 접근 방식
+ * - Locked: 프레임 RW 락으로 보호 (기본)
+ * - Atomic: std::atomic_ref로 락 없이 접근 (1/2/4/8바이트 정렬 필드 전용)
+ */
+enum class SignalAccess : uint8_t { Locked, Atomic };
+
+namespace signal_detail {
+template <typename T>
+struct ArrayTraits {
+  using Element = T;
+  static constexpr size_t count = 1;
+};
+template <typename E, size_t N>
+struct ArrayTraits<std::array<E, N>> {
+  using Element = E;
+  static constexpr size_t count = N;
+};
+
+template <typename T>
+constexpr SignalType scalarTypeOf() {
+  using U = typename std::conditional_t<std::is_enum_v<T>,
+                                        std::underlying_type<T>,
+                                        std::type_identity<T>>::type;
+  if constexpr (std::is_same_v<U, bool>) return SignalType::Bool;
+  else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+    if constexpr (sizeof(U) == 1) return SignalType::Int8;
+    else if constexpr (sizeof(U) == 2) return SignalType::Int16;
+    else if constexpr (sizeof(U) == 4) return SignalType::Int32;
+    else return SignalType::Int64;
+  } else if constexpr (std::is_integral_v<U>) {
+    if constexpr (sizeof(U) == 1) return SignalType::UInt8;
+    else if constexpr (sizeof(U) == 2) return SignalType::UInt16;
+    else if constexpr (sizeof(U) == 4) return SignalType::UInt32;
+    else return SignalType::UInt64;
+  } else if constexpr (std::is_same_v<U, float>) return SignalType::Float;
+  else if constexpr (std::is_same_v<U, double>) return SignalType::Double;
+  else return SignalType::Bytes;
+}
+}  // namespace signal_detail
+
+/**
+ * @brief 신호 디스크립터 (데이터 구조체 내 위치/크기/타입)
+ *
+ * std::array<E, N> 필드는 type이 원소 타입, count가 N입니다.
+ */
+struct SignalDescriptor {
+  uint32_t offset;  ///< 데이터 구조체 시작 기준 바이트 오프셋
+  uint32_t size;    ///< 필드 전체 크기 (바이트)
+  uint32_t count;   ///< 원소 개수 (스칼라는 1)
+  SignalType type;  ///< 원소 타입 태그
+  SignalAccess access = SignalAccess::Locked;  ///< 접근 방식
+
+  /**
+   * @brief 멤버 포인터로부터 디스크립터 생성
+   */
+  template <typename T, typename Field>
+  static SignalDescriptor of(Field T::* member, const T* data_ptr,
+                             SignalAccess access = SignalAccess::Locked) {
+    using Traits = signal_detail::ArrayTraits<Field>;
+    const auto* base = reinterpret_cast<const char*>(data_ptr);
+    const auto* field = reinterpret_cast<const char*>(&(data_ptr->*member));
+    return {static_cast<uint32_t>(field - base),
+            static_cast<uint32_t>(sizeof(Field)),
+            static_cast<uint32_t>(Traits::count),
+            signal_detail::scalarTypeOf<typename Traits::Element>(), access};
+  }
+};
+
+/**
+ * @brief 신호명 → (디스크립터, Getter, Setter) 테이블
+ *
+ * 생성자에서 신호 등록이 끝나면 freeze()로 고정합니다. 고정 시 이름
+ * 해시로 2단계 완전 해시(hash-and-displace) 인덱스를 만들어 조회가
+ * 해시 1회 + 문자열 비교 1회로 끝나도록 합니다. 슬롯 수는 신호 수의
+ * 1.25배 이상인 2의 거듭제곱(적재율 0.4~0.8)이며, 구성에 실패하면
+ * 정렬 배열 + 이진 탐색으로 대체합니다. 인덱스는 이름 구성(순서 포함)이
+ * 같은 테이블끼리 공유하므로 같은 타입의 프레임 인스턴스는 인덱스를
+ * 한 번만 만듭니다. 고정 이후에는 등록이 불가하며, 동시 조회는
+ * 안전합니다.
+ */
+class SignalTable {
+ public:
+  using Getter = std::function<std::any()>;
+  using Setter = std::function<void(const std::any&)>;
+
+  /**
+   * @brief 신호 엔트리 (연속 메모리에 보관)
+   */
+  struct Entry {
+    std::string name;       ///< 신호명
+    SignalDescriptor desc;  ///< 디스크립터
+    Getter getter;          ///< Getter 함수
+    Setter setter;          ///< Setter 함수
+  };
+
+  /**
+   * @brief 신호 등록 (같은 이름은 덮어쓰기)
+   * @throws std::logic_error 고정 이후 등록 시
+   */
+  void add(const std::string& name, const SignalDescriptor& desc,
+           Getter getter, Setter setter) {
+    if (frozen())
+      throw std::logic_error("SignalTable: signal set is frozen: " + name);
+    for (auto& e : entries_) {
+      if (e.name == name) {
+        e = {name, desc, std::move(getter), std::move(setter)};
+        return;
+      }
+    }
+    entries_.push_back({name, desc, std::move(getter), std::move(setter)});
+  }
+
+  /**
+   * @brief 신호 집합 고정 및 완전 해시 인덱스 구성 (또는 공유)
+   * @throws std::logic_error 서로 다른 신호명의 64비트 해시가 같을 때
+   */
+  void freeze() {
+    if (frozen()) return;
+    std::vector<uint64_t> keys;
+    keys.reserve(entries_.size());
+    for (const auto& e : entries_) keys.push_back(hashName(e.name));
+    index_ = sharedIndex(std::move(keys));
+  }
+
+  /**
+   * @brief 고정 여부
+   */
+  bool frozen() const { return index_ != nullptr; }
+
+  /**
+   * @brief 신호명으로 엔트리 조회
+   * @return 엔트리 포인터 (없으면 nullptr)
+   */
+  const Entry* find(std::string_view name) const {
+    if (!index_) {
+      for (const auto& e : entries_)
+        if (e.name == name) return &e;
+      return nullptr;
+    }
+    const uint32_t i = index_->lookup(hashName(name));
+    if (i == kEmpty) return nullptr;
+    const Entry& e = entries_[i];
+    return e.name == name ? &e : nullptr;
+  }
+
+  /**
+   * @brief 전체 엔트리 (등록 순서)
+   */
+  std::span<const Entry> entries() const { return entries_; }
+
+ private:
+  static constexpr uint32_t kEmpty = UINT32_MAX;
+
+  struct Slot {
+    uint64_t key = 0;         ///< 이름 해시 (빠른 불일치 판별용)
+    uint32_t index = kEmpty;  ///< entries_ 인덱스
+  };
+
+  /**
+   * @brief 이름 해시 → 엔트리 인덱스 (불변, 테이블 간 공유)
+   *
+   * 키를 버킷(평균 2개)으로 나누고 큰 버킷부터 모든 키가 빈 슬롯에
+   * 떨어지는 변위(displacement)를 찾아 기록합니다. 조회는
+   * slot = mix(key, seed, disp[bucket(key)]) 한 번입니다.
+   */
+  class Index {
+   public:
+    explicit Index(std::vector<uint64_t> keys) : keys_(std::move(keys)) {
+      std::vector<uint64_t> sorted = keys_;
+      std::sort(sorted.begin(), sorted.end());
+      if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+        throw std::logic_error(
+            "SignalTable: signal name hash collision (rename a signal)");
+      if (keys_.empty()) return;
+      for (uint64_t seed = 1; seed <= kMaxSeedTries; ++seed)
+        if (tryBuild(seed)) return;
+      buildSorted();  // 사실상 도달하지 않는 대체 경로
+    }
+
+    uint32_t lookup(uint64_t key) const {
+      if (!disp_.empty()) {
+        const Slot& s = slots_[slotOf(key, disp_[bucketOf(key)])];
+        return s.key == key ? s.index : kEmpty;
+      }
+      auto it = std::lower_bound(
+          slots_.begin(), slots_.end(), key,
+          [](const Slot& s, uint64_t k) { return s.key < k; });
+      return it != slots_.end() && it->key == key ? it->index : kEmpty;
+    }
+
+    const std::vector<uint64_t>& keys() const { return keys_; }
+
+   private:
+    static constexpr uint64_t kMaxSeedTries = 16;
+    static constexpr uint32_t kMaxDisplacement = 1u << 16;
+
+    static uint64_t mix(uint64_t x) {  // splitmix64 finalizer
+      x ^= x >> 30;
+      x *= 0xBF58476D1CE4E5B9ull;
+      x ^= x >> 27;
+      x *= 0x94D049BB133111EBull;
+      return x ^ (x >> 31);
+    }
+    size_t bucketOf(uint64_t key) const {
+      return static_cast<size_t>(mix(key ^ seed_) % disp_.size());
+    }
+    size_t slotOf(uint64_t key, uint32_t d) const {
+      return static_cast<size_t>(
+          mix(key ^ seed_ ^ ((uint64_t{d} + 1) * 0x9E3779B97F4A7C15ull)) &
+          (slots_.size() - 1));
+    }
+
+    bool tryBuild(uint64_t seed) {
+      const size_t n = keys_.size();
+      size_t m = 1;
+      while (m < n + n / 4) m <<= 1;  // 적재율 0.8 이하
+      seed_ = seed * 0xD6E8FEB86659FD93ull;
+      disp_.assign((n + 1) / 2, 0);
+      slots_.assign(m, Slot{});
+      std::vector<std::vector<uint32_t>> buckets(disp_.size());
+      for (uint32_t i = 0; i < n; ++i)
+        buckets[bucketOf(keys_[i])].push_back(i);
+      std::vector<uint32_t> order(buckets.size());
+      for (uint32_t b = 0; b < order.size(); ++b) order[b] = b;
+      std::stable_sort(order.begin(), order.end(), [&](uint32_t a,
+                                                       uint32_t b) {
+        return buckets[a].size() > buckets[b].size();
+      });
+      std::vector<size_t> taken;
+      for (uint32_t b : order) {
+        if (buckets[b].empty()) break;
+        uint32_t d = 0;
+        for (; d < kMaxDisplacement; ++d) {
+          taken.clear();
+          bool ok = true;
+          for (uint32_t i : buckets[b]) {
+            const size_t s = slotOf(keys_[i], d);
+            if (slots_[s].index != kEmpty ||
+                std::find(taken.begin(), taken.end(), s) != taken.end()) {
+              ok = false;
+              break;
+            }
+            taken.push_back(s);
+          }
+          if (ok) break;
+        }
+        if (d == kMaxDisplacement) return false;
+        disp_[b] = d;
+        for (uint32_t i : buckets[b])
+          slots_[slotOf(keys_[i], d)] = {keys_[i], i};
+      }
+      return true;
+    }
+
+    void buildSorted() {
+      disp_.clear();
+      slots_.clear();
+      for (uint32_t i = 0; i < keys_.size(); ++i)
+        slots_.push_back({keys_[i], i});
+      std::sort(slots_.begin(), slots_.end(),
+                [](const Slot& a, const Slot& b) { return a.key < b.key; });
+    }
+
+    std::vector<uint64_t> keys_;  ///< 등록 순서 키 (공유 판별용)
+    uint64_t seed_ = 0;           ///< 해시 seed
+    std::vector<uint32_t> disp_;  ///< 버킷별 변위 (비면 정렬 배열 모드)
+    std::vector<Slot> slots_;     ///< 슬롯 (정렬 배열 모드에선 키 순)
+  };
+
+  /**
+   * @brief 같은 키 구성의 인덱스를 찾거나 만들어 등록
+   *
+   * 캐시는 weak_ptr만 보관하므로 마지막 테이블이 사라지면 인덱스도
+   * 해제됩니다. 만료된 엔트리는 같은 지문 버킷을 조회할 때 정리합니다.
+   */
+  static std::shared_ptr<const Index> sharedIndex(std::vector<uint64_t> keys) {
+    uint64_t fp = keys.size();
+    for (uint64_t k : keys) fp = (fp ^ k) * 1099511628211ull;
+    static std::mutex mtx;
+    static std::unordered_map<uint64_t,
+                              std::vector<std::weak_ptr<const Index>>> cache;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto& list = cache[fp];
+    std::shared_ptr<const Index> found;
+    std::erase_if(list, [&](const std::weak_ptr<const Index>& w) {
+      auto idx = w.lock();
+      if (!idx) return true;
+      if (!found && idx->keys() == keys) found = std::move(idx);
+      return false;
+    });
+    if (found) return found;
+    try {
+      found = std::make_shared<const Index>(std::move(keys));
+    } catch (...) {
+      if (list.empty()) cache.erase(fp);
+      throw;
+    }
+    list.push_back(found);
+    return found;
+  }
+
+  static uint64_t hashName(std::string_view s) {
+    uint64_t h = 14695981039346656037ull;  // FNV-1a
+    for (unsigned char c : s) {
+      h ^= c;
+      h *= 1099511628211ull;
+    }
+    return h;
+  }
+
+  std::vector<Entry> entries_;          ///< 신호 엔트리 (등록 순서)
+  std::shared_ptr<const Index> index_;  ///< 고정 후 조회 인덱스 (공유)
+};
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_SIGNALTABLE_HPP
@@ -0,0 +1,488 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_FRAME_ZEROCOPY_HPP
+#define NEXUM_COM_EXTERNAL_FRAME_ZEROCOPY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "SignalTable.hpp"
+
+/**
+ * @brief 오프셋 테이블 항목 (와이어상 16바이트)
+ */
+struct ZeroCopyEntry {
+  uint32_t nameHash;  ///< 신호명 해시 (FNV-1a 32)
+  uint32_t offset;    ///< 페이로드 시작 기준 오프셋
+  uint32_t size;      ///< 필드 전체 크기
+  uint32_t count;     ///< 원소 개수 (스칼라는 1)
+  SignalType type;    ///< 원소 타입 태그
+};
+
+/**
+ * @brief 제로카피 포맷 스키마 (프레임 신호로부터 구성)
+ *
+ * | 오프셋      | 내용                                              |
+ * |-------------|---------------------------------------------------|
+ * | 0           | 매직 "NCZ1" (uint32 LE)                           |
+ * | 4           | 전체 크기 (uint32)                                |
+ * | 8           | 스키마 해시 (uint32, 테이블 + 페이로드 크기)      |
+ * | 12          | 필드 수 n (uint16), 예약 (uint16)                 |
+ * | 16          | 테이블 n x 16바이트 (이름 해시 오름차순)          |
+ * |             | {nameHash, offset, size, count << 8 \| type}      |
+ * | 16 + 16n    | 페이로드 = 데이터 구조체 원본 (8바이트 정렬 위치) |
+ *
+ * 인코딩은 미리 만든 헤더/테이블 복사 + 구조체 memcpy 한 번입니다.
+ * 수신 측은 테이블에서 이름 해시로 필드를 찾아 버퍼에서 바로 읽으므로
+ * 역직렬화가 없고, 레이아웃이 다른 송신자의 버퍼도 이름으로 읽을 수
+ * 있습니다.
+ */
+class ZeroCopySchema {
+ public:
+  static constexpr uint32_t kMagic = 0x315A434E;  ///< "NCZ1"
+  static constexpr size_t kHeaderSize = 16;       ///< 헤더 크기
+  static constexpr size_t kEntrySize = 16;        ///< 테이블 항목 크기
+  static constexpr uint32_t kMaxCount = 0xFFFFFF;  ///< 최대 원소 개수
+
+  /**
+   * @brief 스키마 구성
+   * @param signals 신호 엔트리
+   * @param payloadSize 데이터 구조체 크기
+   * @throws std::invalid_argument 신호명 해시 충돌/필드 수 초과/
+   *         원소 개수가 24비트를 넘는 경우
+   */
+  ZeroCopySchema(std::span<const SignalTable::Entry> signals,
+                 size_t payloadSize)
+      : payloadSize_(payloadSize) {
+    std::vector<ZeroCopyEntry> entries;
+    for (const auto& e : signals) {
+      if (e.desc.count > kMaxCount)  // 테이블에 count << 8로 들어감
+        throw std::invalid_argument(
+            "ZeroCopySchema: element count exceeds 24 bits: " + e.name);
+      entries.push_back({hashName(e.name), e.desc.offset, e.desc.size,
+                         e.desc.count, e.desc.type});
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const ZeroCopyEntry& a, const ZeroCopyEntry& b) {
+                return a.nameHash < b.nameHash;
+              });
+    for (size_t i = 1; i < entries.size(); ++i)
+      if (entries[i].nameHash == entries[i - 1].nameHash)
+        throw std::invalid_argument("ZeroCopySchema: signal name hash clash");
+    if (entries.size() > UINT16_MAX)
+      throw std::invalid_argument("ZeroCopySchema: too many signals");
+
+    prefix_.resize(kHeaderSize + entries.size() * kEntrySize);
+    std::byte* p = prefix_.data() + kHeaderSize;
+    for (const auto& e : entries) {
+      putU32(p, e.nameHash);
+      putU32(p + 4, e.offset);
+      putU32(p + 8, e.size);
+      putU32(p + 12, e.count << 8 | static_cast<uint8_t>(e.type));
+      p += kEntrySize;
+    }
+    uint32_t h = 2166136261u;
+    for (size_t i = kHeaderSize; i < prefix_.size(); ++i)
+      h = (h ^ static_cast<uint8_t>(prefix_[i])) * 16777619u;
+    for (int i = 0; i < 4; ++i)
+      h = (h ^ static_cast<uint8_t>(payloadSize >> (8 * i))) * 16777619u;
+    schemaHash_ = h;
+    putU32(prefix_.data(), kMagic);
+    putU32(prefix_.data() + 4, static_cast<uint32_t>(encodedSize()));
+    putU32(prefix_.data() + 8, schemaHash_);
+    auto n = static_cast<uint16_t>(entries.size());
+    std::memcpy(prefix_.data() + 12, &n, 2);
+  }
+
+  /**
+   * @brief 인코딩 크기 (헤더 + 테이블 + 페이로드)
+   */
+  size_t encodedSize() const { return prefix_.size() + payloadSize_; }
+
+  /**
+   * @brief 데이터 구조체 크기
+   */
+  size_t payloadSize() const { return payloadSize_; }
+
+  /**
+   * @brief 스키마 해시
+   */
+  uint32_t schemaHash() const { return schemaHash_; }
+
+  /**
+   * @brief 필드 수
+   */
+  size_t fieldCount() const {
+    return (prefix_.size() - kHeaderSize) / kEntrySize;
+  }
+
+  /**
+   * @brief 인코딩
+   * @param data 데이터 구조체
+   * @param out 출력 버퍼 (encodedSize() 이상)
+   * @return 기록한 바이트 수
+   * @throws std::runtime_error 크기가 맞지 않는 경우
+   */
+  size_t encode(std::span<const std::byte> data,
+                std::span<std::byte> out) const {
+    if (data.size() != payloadSize_ || out.size() < encodedSize())
+      throw std::runtime_error("ZeroCopySchema: encode size mismatch: data " +
+                               std::to_string(data.size()) + ", buffer " +
+                               std::to_string(out.size()));
+    std::memcpy(out.data(), prefix_.data(), prefix_.size());
+    std::memcpy(out.data() + prefix_.size(), data.data(), payloadSize_);
+    return encodedSize();
+  }
+
+  /**
+   * @brief 신호명 해시 (FNV-1a 32)
+   */
+  static constexpr uint32_t hashName(std::string_view name) {
+    uint32_t h = 2166136261u;
+    for (char c : name) h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+    return h;
+  }
+
+ private:
+  friend class ZeroCopyView;
+
+  static void putU32(std::byte* p, uint32_t v) { std::memcpy(p, &v, 4); }
+
+  size_t payloadSize_;             ///< 데이터 구조체 크기
+  uint32_t schemaHash_ = 0;        ///< 스키마 해시
+  std::vector<std::byte> prefix_;  ///< 헤더 + 테이블
+};
+
+/**
+ * @brief 신뢰할 수 없는 바이트에서 값 하나 읽기 (정렬 무관)
+ *
+ * bool은 0/1 이외의 바이트를 거부합니다. 열거형은 모든 기반 타입 값이
+ * 유효한 scoped enum만 허용합니다 (unscoped enum은 기반 타입으로 읽음).
+ * @throws std::runtime_error bool 값이 0/1이 아닌 경우
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+inline T zeroCopyLoad(const std::byte* p) {
+  if constexpr (std::is_same_v<T, bool>) {
+    const auto b = static_cast<uint8_t>(*p);
+    if (b > 1) throw std::runtime_error("ZeroCopyView: invalid bool value");
+    return b != 0;
+  } else {
+    if constexpr (std::is_enum_v<T>)
+      static_assert(!std::is_convertible_v<T, std::underlying_type_t<T>>,
+                    "ZeroCopyView: read unscoped enums via their underlying "
+                    "type (value range is not fixed)");
+    T v;
+    std::memcpy(&v, p, sizeof(T));
+    return v;
+  }
+}
+
+/**
+ * @brief 배열 필드의 제자리 읽기 뷰
+ * @tparam E 원소 타입
+ */
+template <typename E>
+  requires std::is_trivially_copyable_v<E>
+class ZeroCopyArray {
+ public:
+  ZeroCopyArray(const std::byte* data, size_t count)
+      : data_(data), count_(count) {}
+
+  size_t size() const { return count_; }
+
+  /**
+   * @brief 원소 읽기 (정렬 무관)
+   * @throws std::runtime_error 표현할 수 없는 bool 값
+   */
+  E operator[](size_t i) const {
+    return zeroCopyLoad<E>(data_ + i * sizeof(E));
+  }
+
+  /**
+   * @brief 원소 영역 원본 바이트
+   */
+  std::span<const std::byte> bytes() const {
+    return {data_, count_ * sizeof(E)};
+  }
+
+ private:
+  const std::byte* data_;  ///< 첫 원소 위치
+  size_t count_;           ///< 원소 개수
+};
+
+/**
+ * @brief 제로카피 읽기 뷰 (수신 버퍼 또는 프레임 데이터 위)
+ *
+ * 복사/역직렬화 없이 신호를 제자리에서 읽습니다. 뷰는 버퍼를 소유하지
+ * 않으므로 버퍼보다 오래 쓰면 안 됩니다. 읽기 타입의 크기가 필드와
+ * 다르면 std::runtime_error를 던집니다.
+ */
+class ZeroCopyView {
+ public:
+  /**
+   * @brief 수신 버퍼 해석 (헤더/테이블 범위 검증, O(필드 수))
+   * @param buf 인코딩된 버퍼
+   * @throws std::runtime_error 형식 오류
+   */
+  static ZeroCopyView parse(std::span<const std::byte> buf) {
+    constexpr size_t H = ZeroCopySchema::kHeaderSize;
+    constexpr size_t E = ZeroCopySchema::kEntrySize;
+    if (buf.size() < H) fail("truncated header");
+    if (u32(buf.data()) != ZeroCopySchema::kMagic) fail("bad magic");
+    if (u32(buf.data() + 4) != buf.size()) fail("size mismatch");
+    uint16_t n;
+    std::memcpy(&n, buf.data() + 12, 2);
+    if (buf.size() - H < size_t{n} * E) fail("truncated table");
+    ZeroCopyView v;
+    v.table_ = buf.data() + H;
+    v.count_ = n;
+    v.payload_ = v.table_ + size_t{n} * E;
+    v.payloadSize_ = buf.size() - H - size_t{n} * E;
+    v.schemaHash_ = u32(buf.data() + 8);
+    uint32_t prev = 0;
+    for (size_t i = 0; i < n; ++i) {
+      ZeroCopyEntry e = v.entry(i);
+      if (i && e.nameHash <= prev) fail("unsorted table");
+      if (e.offset > v.payloadSize_ || v.payloadSize_ - e.offset < e.size ||
+          e.count == 0 || e.size % e.count != 0)
+        fail("field out of range");
+      if (e.type > SignalType::Bytes) fail("unknown signal type");
+      prev = e.nameHash;
+    }
+    return v;
+  }
+
+  /**
+   * @brief 헤더 없는 데이터 구조체 위의 뷰 (프레임 내부 데이터용)
+   * @param schema 프레임 스키마
+   * @param payload 데이터 구조체 바이트
+   * @throws std::runtime_error 크기가 맞지 않는 경우
+   */
+  ZeroCopyView(const ZeroCopySchema& schema, std::span<const std::byte> payload)
+      : table_(schema.prefix_.data() + ZeroCopySchema::kHeaderSize),
+        count_(schema.fieldCount()),
+        payload_(payload.data()),
+        payloadSize_(payload.size()),
+        schemaHash_(schema.schemaHash()) {
+    if (payload.size() != schema.payloadSize()) fail("payload size mismatch");
+  }
+
+  size_t fieldCount() const { return count_; }
+  uint32_t schemaHash() const { return schemaHash_; }
+
+  /**
+   * @brief 페이로드(데이터 구조체) 원본 바이트
+   */
+  std::span<const std::byte> payload() const {
+    return {payload_, payloadSize_};
+  }
+
+  /**
+   * @brief i번째 테이블 항목 (이름 해시 오름차순)
+   */
+  ZeroCopyEntry entry(size_t i) const {
+    const std::byte* p = table_ + i * ZeroCopySchema::kEntrySize;
+    uint32_t packed = u32(p + 12);
+    return {u32(p), u32(p + 4), u32(p + 8), packed >> 8,
+            static_cast<SignalType>(packed & 0xFF)};
+  }
+
+  /**
+   * @brief 이름 해시로 항목 번호 검색 (이진 탐색)
+   * @return 항목 번호 (없으면 SIZE_MAX)
+   */
+  size_t indexOf(uint32_t nameHash) const {
+    size_t lo = 0, hi = count_;
+    while (lo < hi) {
+      size_t mid = (lo + hi) / 2;
+      uint32_t h = u32(table_ + mid * ZeroCopySchema::kEntrySize);
+      if (h == nameHash) return mid;
+      if (h < nameHash) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return SIZE_MAX;
+  }
+
+  /**
+   * @brief 신호 존재 여부
+   */
+  bool has(std::string_view name) const {
+    return indexOf(ZeroCopySchema::hashName(name)) != SIZE_MAX;
+  }
+
+  /**
+   * @brief 신호 원본 바이트
+   * @throws std::runtime_error 신호가 없는 경우
+   */
+  std::span<const std::byte> bytes(std::string_view name) const {
+    ZeroCopyEntry e = require(name);
+    return {payload_ + e.offset, e.size};
+  }
+
+  /**
+   * @brief 스칼라/구조체 신호 읽기
+   * @tparam T 신호 타입 (필드 크기와 같아야 함)
+   */
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  T get(std::string_view name) const {
+    return read<T>(require(name));
+  }
+
+  /**
+   * @brief 배열 신호 뷰
+   * @tparam E 원소 타입 (원소 크기와 같아야 함)
+   */
+  template <typename E>
+    requires std::is_trivially_copyable_v<E>
+  ZeroCopyArray<E> array(std::string_view name) const {
+    return arrayAt<E>(require(name));
+  }
+
+  /**
+   * @brief 항목으로 스칼라 읽기 (ZeroCopyField 등 캐시 경로용)
+   */
+  template <typename T>
+  T read(const ZeroCopyEntry& e) const {
+    if (e.size != sizeof(T)) fail("type size mismatch");
+    return zeroCopyLoad<T>(payload_ + e.offset);
+  }
+
+  /**
+   * @brief 항목으로 배열 뷰 생성
+   */
+  template <typename E>
+  ZeroCopyArray<E> arrayAt(const ZeroCopyEntry& e) const {
+    if (e.size != e.count * sizeof(E)) fail("element size mismatch");
+    return ZeroCopyArray<E>(payload_ + e.offset, e.count);
+  }
+
+ private:
+  ZeroCopyView() = default;
+
+  [[noreturn]] static void fail(const char* what) {
+    throw std::runtime_error(std::string("ZeroCopyView: ") + what);
+  }
+
+  static uint32_t u32(const std::byte* p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+  }
+
+  ZeroCopyEntry require(std::string_view name) const {
+    size_t i = indexOf(ZeroCopySchema::hashName(name));
+    if (i == SIZE_MAX)
+      throw std::runtime_error("ZeroCopyView: no signal " + std::string(name));
+    return entry(i);
+  }
+
+  const std::byte* table_ = nullptr;    ///< 테이블 시작
+  size_t count_ = 0;                    ///< 항목 수
+  const std::byte* payload_ = nullptr;  ///< 페이로드 시작
+  size_t payloadSize_ = 0;              ///< 페이로드 크기
+  uint32_t schemaHash_ = 0;             ///< 스키마 해시
+};
+
+/**
+ * @brief 이름을 한 번만 해석하는 신호 접근자
+ *
+ * 마지막으로 본 스키마 해시와 항목 번호를 기억해, 같은 스키마의 버퍼는
+ * 검색 없이 바로 읽습니다. 여러 스레드에서 공유해도 안전합니다.
+ * @tparam T 신호 타입
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class ZeroCopyField {
+ public:
+  explicit ZeroCopyField(std::string_view name)
+      : name_(name), hash_(ZeroCopySchema::hashName(name)) {}
+
+  /**
+   * @brief 뷰에서 신호 읽기
+   * @throws std::runtime_error 신호가 없거나 크기가 다른 경우
+   */
+  T operator()(const ZeroCopyView& view) const {
+    return view.read<T>(lookup(view));
+  }
+
+  /**
+   * @brief 배열 신호 뷰 (T가 원소 타입일 때)
+   */
+  ZeroCopyArray<T> array(const ZeroCopyView& view) const {
+    return view.arrayAt<T>(lookup(view));
+  }
+
+ private:
+  // 캐시된 항목도 이름 해시를 다시 확인 (같은 해시의 다른 테이블 대비)
+  ZeroCopyEntry lookup(const ZeroCopyView& view) const {
+    uint64_t c = cache_.load(std::memory_order_relaxed);
+    if (c != kEmpty && static_cast<uint32_t>(c >> 32) == view.schemaHash()) {
+      size_t i = static_cast<size_t>(c & 0xFFFFFFFF);
+      if (i < view.fieldCount()) {
+        ZeroCopyEntry e = view.entry(i);
+        if (e.nameHash == hash_) return e;
+      }
+    }
+    size_t i = view.indexOf(hash_);
+    if (i == SIZE_MAX)
+      throw std::runtime_error("ZeroCopyField: no signal " + name_);
+    cache_.store(uint64_t{view.schemaHash()} << 32 | i,
+                 std::memory_order_relaxed);
+    return view.entry(i);
+  }
+
+  static constexpr uint64_t kEmpty = UINT64_MAX;
+
+  std::string name_;                             ///< 신호명
+  uint32_t hash_;                                ///< 신호명 해시
+  mutable std::atomic<uint64_t> cache_{kEmpty};  ///< (스키마 해시, 항목)
+};
+
+#endif  // NEXUM_COM_EXTERNAL_FRAME_ZEROCOPY_HPP
@@ -41,13 +41,37 @@
 #include "method/IMethod.h"  // class IMethod
 #include "port/IPort.h"      // class IPort
 
+// 신호 디스크립터 / 완전 해시 테이블
+#include "frame/SignalTable.hpp"  // class SignalTable, struct SignalDescriptor
+
 // CRTP 기반 default Useage
-#include "frame/FrameBase.hpp"  // class FrameBase<DataT,Derived>
-#include "port/PortBase.hpp"    // class PortBase<Derived>
+#include "frame/AtomicFrameBase.hpp"   // class AtomicFrameBase<DataT,Derived>
+#include "frame/CompactCodec.hpp"      // class CompactCodec (압축 와이어 포맷)
+#include "frame/Crc.hpp"               // struct Crc (CRC8/16/32C)
+#include "frame/E2E.hpp"               // class E2EChannel, struct E2EProfile
+#include "frame/FrameBase.hpp"         // class FrameBase<DataT,Derived>
+#include "frame/FrameCapture.hpp"      // class FrameCapture (pcapng)
+#include "frame/LayoutConversion.hpp"  // class FrameLayout, LayoutProgram
+#include "frame/PublishBatch.hpp"      // class PublishBatch
+#include "frame/ZeroCopy.hpp"          // class ZeroCopySchema, ZeroCopyView
+#include "port/IPortDefaults.hpp"       // IPort 기본 구현
+#include "port/PortBase.hpp"           // class PortBase<Derived>
+#include "port/VirtualBus.hpp"         // class VirtualBus
+#include "port/VirtualBusPort.hpp"     // class VirtualBusPort
+
+// 콜백/메서드 실행기
+#include "executor/CyclicExecutor.hpp"         // class CyclicExecutor
+#include "executor/DeadlineScheduler.hpp"      // class DeadlineScheduler
+#include "executor/IExecutor.h"                // class IExecutor
+#include "executor/SimulationRuntime.hpp"      // class SimulationRuntime
+#include "executor/Strand.hpp"                 // class Strand
+#include "executor/WorkStealingScheduler.hpp"  // class WorkStealingScheduler
 
 // Factory & Register 패턴 기반 초기화 클래스
-#include "bus_Factory/AutoRegister.hpp"     // struct AutoRegister<Derived,Base>
-#include "bus_Factory/FactoryRegistry.hpp"  // class FactoryRegistry<Base>
-#include "bus_Factory/FrameBus.hpp"         // class FrameBus (싱글톤)
+#include "bus_Factory/AutoRegister.hpp"       // struct AutoRegister<D,Base>
+#include "bus_Factory/FactoryRegistry.hpp"    // class FactoryRegistry<Base>
+#include "bus_Factory/FrameBus.hpp"           // class FrameBus (싱글톤)
+#include "bus_Factory/FrameJsonExporter.hpp"  // class FrameJsonExporter
+#include "bus_Factory/FrameSnapshot.hpp"      // class FrameSnapshot
 
 #endif
\ No newline at end of file
@@ -36,13 +36,18 @@
 #ifndef NEXUM_COM_INTERFACE_IMETHOD_H
 #define NEXUM_COM_INTERFACE_IMETHOD_H
 #include <any>
+#include <exception>
 #include <functional>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "../executor/IExecutor.h"
+
 /**
  * @brief 동적 메서드 호출 및 등록을 지원하는 인터페이스 클래스
  *
@@ -81,6 +86,29 @@ class IMethod {
     return it->second(args);
   }
 
+  /**
+   * @brief 메서드를 실행기에서 비동기로 호출합니다.
+   * @param methodName 호출할 메서드명 (string)
+   * @param executor 호출을 실행할 실행기
+   * @param args std::any 파라미터 벡터 (기본값: 빈 벡터)
+   * @return std::future<std::any> 반환값 (미등록/예외 시 예외 전달)
+   * @note 호출이 끝날 때까지 객체가 살아 있어야 합니다.
+   */
+  std::future<std::any> invokeAsync(const std::string& methodName,
+                                    IExecutor& executor,
+                                    std::vector<std::any> args = {}) {
+    auto promise = std::make_shared<std::promise<std::any>>();
+    auto future = promise->get_future();
+    executor.post([this, promise, methodName, args = std::move(args)] {
+      try {
+        promise->set_value(invoke(methodName, args));
+      } catch (...) {
+        promise->set_exception(std::current_exception());
+      }
+    });
+    return future;
+  }
+
   /**
    * @brief 메서드를 등록합니다. (람다, 프리함수, 멤버함수 등 모두 지원)
    * @tparam F 함수 객체 타입 (임의)
@@ -35,14 +35,20 @@
 #ifndef NEXUM_COM_EXTERNAL_PORT_IPORT_H
 #define NEXUM_COM_EXTERNAL_PORT_IPORT_H
 
+#include <any>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
+#include "../executor/IExecutor.h"
 #include "../method/IMethod.h"
 
 class IFrame;
+class ZeroCopyView;
 
 /**
  * @brief 외부 접점(Port)와 FrameBus 연동을 위한 추상 인터페이스
@@ -51,6 +57,13 @@ class IFrame;
  * 구조(IFrame)를 연결하고 데이터 송수신, 콜백 구독을 통합 관리하기 위한 추상화
  * 레이어입니다. 모든 Port 구현체는 본 인터페이스를 상속받아야 하며, 멀티 프레임
  * 연결 및 다양한 데이터 타입 전달/구독이 가능합니다.
+ *
+ * 버퍼 직렬화, 실행기 구독, 제로카피 뷰 구독은 기존 Raw/구독 API로 동작하는
+ * 기본 구현을 제공하므로, PortBase를 쓰지 않는 구현체도 그대로 빌드됩니다.
+ * 기본 구현은 복사가 한 번씩 더 들어가므로 필요하면 재정의하십시오.
+ * 기본 구현 본문은 IPortDefaults.hpp에 있으며, PortBase.hpp와
+ * interface.h가 포함합니다. PortBase 없이 IPort를 직접 구현하는 번역
+ * 단위는 IPortDefaults.hpp를 포함해야 합니다.
  */
 class IPort : public IMethod {
  public:
@@ -135,6 +148,39 @@ class IPort : public IMethod {
   virtual bool setRawDataToFrameWithPublish(const std::string& frameName,
                                             const char* data, size_t size) = 0;
 
+  /**
+   * @brief 프레임을 호출자 I/O 버퍼에 직접 직렬화 (송신 경로, 할당 없음)
+   *
+   * 기본 구현은 getRawDataFromFrame의 원시 데이터를 복사합니다.
+   * @param frameName 프레임명
+   * @param out 출력 버퍼
+   * @return 기록된 바이트 수 (실패/버퍼 부족 시 0)
+   */
+  virtual size_t serializeFrameInto(const std::string& frameName,
+                                    std::span<std::byte> out);
+
+  /**
+   * @brief 호출자 I/O 버퍼로부터 프레임 역직렬화 (수신 경로, Publish 없음)
+   *
+   * 기본 구현은 setRawDataToFrame으로 전달합니다.
+   * @param frameName 프레임명
+   * @param in 수신 데이터
+   * @return 성공 여부
+   */
+  virtual bool deserializeFrameFrom(const std::string& frameName,
+                                    std::span<const std::byte> in);
+
+  /**
+   * @brief 호출자 I/O 버퍼로부터 프레임 역직렬화 및 바로 Publish
+   *
+   * 기본 구현은 setRawDataToFrameWithPublish로 전달합니다.
+   * @param frameName 프레임명
+   * @param in 수신 데이터
+   * @return 성공 여부
+   */
+  virtual bool deserializeFrameFromWithPublish(
+      const std::string& frameName, std::span<const std::byte> in);
+
   /**
    * @brief 프레임의 시그널 값을 std::any로 조회
    * @param frameName 프레임명
@@ -187,6 +233,36 @@ class IPort : public IMethod {
       const std::string& frameName,
       std::function<void(const char*, size_t)> cb) = 0;
 
+  /**
+   * @brief 프레임 데이터 콜백 구독 (공유 실행기에서 호출, 구독별 순서 보장)
+   *
+   * 기본 구현은 subscribeFrameDirect로 받은 데이터를 복사해 구독별 Strand로
+   * 실행기에 넘깁니다. (해제 후에도 이미 넘긴 작업은 실행될 수 있음)
+   * @param frameName 프레임명
+   * @param executor 콜백을 실행할 실행기
+   * @param cb 데이터 수신 시 호출될 콜백
+   * @param attr 우선순위 / 마감 속성
+   * @return uint64_t 콜백 인스턴스 ID
+   */
+  virtual uint64_t subscribeFrameOn(
+      const std::string& frameName, IExecutor& executor,
+      std::function<void(const char*, size_t)> cb,
+      const DispatchAttr& attr = {});
+
+  /**
+   * @brief 프레임 제로카피 뷰 구독 (Direct: 역직렬화 없이 이름으로 읽기)
+   *
+   * 기본 구현은 FrameBus의 같은 이름 프레임 신호로 스키마를 만들고,
+   * subscribeFrameDirect로 받은 데이터 위에 뷰를 만들어 넘깁니다. 이 경우
+   * 콜백은 subscribeFrameDirect 콜백과 같은 문맥(락 포함)에서 실행됩니다.
+   * @param frameName 프레임명
+   * @param cb 데이터 수신 시 호출될 콜백 (뷰는 콜백 안에서만 유효)
+   * @return uint64_t 콜백 인스턴스 ID (프레임/스키마 구성 실패 시 0)
+   */
+  virtual uint64_t subscribeFrameView(
+      const std::string& frameName,
+      std::function<void(const ZeroCopyView&)> cb);
+
   /**
    * @brief 프레임 콜백 구독 해제
    * @param callbackId 구독 시 반환받은 인스턴스 ID
@@ -194,4 +270,4 @@ class IPort : public IMethod {
   virtual void unsubscribeFrame(uint64_t callbackId) = 0;
 };
 
-#endif
\ No newline at end of file
+#endif
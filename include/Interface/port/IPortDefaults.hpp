@@ -0,0 +1,110 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_PORT_IPORTDEFAULTS_HPP
+#define NEXUM_COM_EXTERNAL_PORT_IPORTDEFAULTS_HPP
+
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../bus_Factory/FrameBus.hpp"
+#include "../executor/Strand.hpp"
+#include "../frame/ZeroCopy.hpp"
+#include "IPort.h"
+
+// ------------------- IPort 기본 구현부 -------------------
+
+inline size_t IPort::serializeFrameInto(const std::string& frameName,
+                                        std::span<std::byte> out) {
+  size_t written = 0;
+  getRawDataFromFrame(frameName, [&](const char* data, size_t size) {
+    if (size > out.size()) return;
+    std::memcpy(out.data(), data, size);
+    written = size;
+  });
+  return written;
+}
+
+inline bool IPort::deserializeFrameFrom(const std::string& frameName,
+                                        std::span<const std::byte> in) {
+  return setRawDataToFrame(
+      frameName, reinterpret_cast<const char*>(in.data()), in.size());
+}
+
+inline bool IPort::deserializeFrameFromWithPublish(
+    const std::string& frameName, std::span<const std::byte> in) {
+  return setRawDataToFrameWithPublish(
+      frameName, reinterpret_cast<const char*>(in.data()), in.size());
+}
+
+inline uint64_t IPort::subscribeFrameOn(
+    const std::string& frameName, IExecutor& executor,
+    std::function<void(const char*, size_t)> cb, const DispatchAttr& attr) {
+  auto strand = std::make_shared<Strand>(executor);
+  return subscribeFrameDirect(
+      frameName, [strand, cb, attr](const char* data, size_t size) {
+        strand->post(
+            [cb, copy = std::vector<char>(data, data + size)] {
+              cb(copy.data(), copy.size());
+            },
+            attr);
+      });
+}
+
+inline uint64_t IPort::subscribeFrameView(
+    const std::string& frameName,
+    std::function<void(const ZeroCopyView&)> cb) {
+  auto frame = FrameBus::instance().getFrame(frameName);
+  if (!frame) return 0;
+  std::shared_ptr<const ZeroCopySchema> schema;
+  try {
+    schema = std::make_shared<const ZeroCopySchema>(frame->signalEntries(),
+                                                    frame->size());
+  } catch (const std::exception&) {
+    return 0;  // 스키마로 표현할 수 없는 신호 구성
+  }
+  return subscribeFrameDirect(
+      frameName, [schema, cb](const char* data, size_t size) {
+        if (size != schema->payloadSize()) return;
+        cb(ZeroCopyView(*schema, std::as_bytes(std::span(data, size))));
+      });
+}
+
+#endif
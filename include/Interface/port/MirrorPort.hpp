@@ -0,0 +1,693 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_PORT_MIRRORPORT_HPP
+#define NEXUM_COM_EXTERNAL_PORT_MIRRORPORT_HPP
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "PortBase.hpp"
+
+/**
+ * @brief 프로세스 간 프레임 미러링 포트 (TCP 루프백, 증분 동기화)
+ *
+ * Source 역할은 연결된 프레임을 감시하다 변경분을 접속한 Mirror들에
+ * 보냅니다. 새로 접속한 Mirror에는 먼저 전체 상태를 보내고(bulk), 이후에는
+ * 직전에 보낸 상태와 달라진 바이트 구간만 버전과 함께 보냅니다(delta).
+ * 한 번의 송신 라운드에 모인 모든 프레임 갱신은 writev 1회(IOV_MAX 단위)로
+ * 묶여 전송되며, Mirror는 배치를 적용한 뒤 프레임당 한 번만 publish합니다.
+ *
+ * Source는 보낸 직후 그 Mirror의 shadow를 갱신하므로, Mirror가 레코드를
+ * 거부하면(오래된 버전, 없는 프레임, 크기 불일치) 양쪽 상태가 어긋납니다.
+ * 이때 Mirror는 해당 프레임의 전체 재전송을 요청하고, Source는 다음 송신
+ * 라운드에 그 프레임을 bulk로 다시 보냅니다. 요청은 프레임이 다시 적용될
+ * 때까지 한 번만 보냅니다.
+ *
+ * 사용:
+ * - Source: configureSource(port) → connectFrame(...) → open()
+ * - Mirror: configureMirror(host, port) → connectFrame(...) → open()
+ *
+ * @note open() 이전에 연결된 프레임만 미러링됩니다. 양쪽 프레임은 같은
+ *       이름과 크기(데이터 레이아웃)를 가져야 하며, 루프백 전용이므로
+ *       호스트 바이트 순서를 그대로 사용합니다.
+ */
+class MirrorPort : public PortBase<MirrorPort> {
+ public:
+  /**
+   * @brief 송수신 통계
+   */
+  struct Stats {
+    uint64_t batches = 0;       ///< 송신/수신 배치 수
+    uint64_t bulkRecords = 0;   ///< 전체 상태 레코드 수
+    uint64_t deltaRecords = 0;  ///< 증분 레코드 수
+    uint64_t bytes = 0;         ///< 전송 바이트 (헤더 포함)
+    uint64_t publishes = 0;     ///< Mirror 측 publish 수
+    uint64_t rejected = 0;      ///< 알 수 없는 프레임/크기 불일치/오래된 버전
+    uint64_t resyncs = 0;       ///< 재동기화 요청 (Mirror: 보냄, Source: 받음)
+  };
+
+  explicit MirrorPort(const std::string& instanceName)
+      : PortBase(instanceName) {}
+  ~MirrorPort() override { close(); }
+
+  static std::string staticName() { return "MirrorPort"; }
+  std::string type() const override { return "mirror"; }
+
+  /**
+   * @brief Source 역할 설정 (127.0.0.1:port 에서 대기, 0이면 임의 포트)
+   */
+  void configureSource(uint16_t port = 0) {
+    role_ = Role::Source;
+    port_ = port;
+  }
+
+  /**
+   * @brief Mirror 역할 설정 (host:port 의 Source에 접속)
+   */
+  void configureMirror(const std::string& host, uint16_t port) {
+    role_ = Role::Mirror;
+    host_ = host;
+    port_ = port;
+  }
+
+  /**
+   * @brief 소켓 열기 및 송수신 스레드 시작
+   * @return 성공 여부 (역할 미설정/소켓 오류 시 false)
+   */
+  bool open() override;
+
+  /**
+   * @brief 스레드 종료 및 소켓/구독 해제
+   */
+  void close() override;
+
+  /**
+   * @brief Source가 실제로 바인드한 포트
+   */
+  uint16_t boundPort() const { return port_; }
+
+  /**
+   * @brief Mirror가 마지막으로 적용한 원격 버전 (없으면 0)
+   */
+  uint64_t remoteVersion(const std::string& frameName) const;
+
+  /**
+   * @brief 송수신 통계
+   */
+  Stats stats() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return stats_;
+  }
+
+ private:
+  enum class Role { None, Source, Mirror };
+
+  static constexpr uint32_t kMagic = 0x424D584E;        // "NXMB"
+  static constexpr uint32_t kResyncMagic = 0x5253584E;  // "NXSR"
+  static constexpr uint8_t kFull = 0;
+  static constexpr uint8_t kDelta = 1;
+  static constexpr size_t kMergeGap = 16;  // 이보다 가까운 변경 구간은 병합
+  /// Source가 변경이 없을 때도 재동기화 요청을 확인하는 주기
+  static constexpr std::chrono::milliseconds kResyncPoll{100};
+
+  struct BatchHeader {
+    uint32_t magic;
+    uint32_t records;
+    uint32_t bytes;  ///< 헤더 이후 바이트 수
+  };
+  struct RecordHeader {
+    uint64_t version;
+    uint32_t frameSize;
+    uint16_t nameLen;
+    uint16_t ranges;
+    uint8_t kind;
+    uint8_t pad[7];
+  };
+  struct RangeHeader {
+    uint32_t offset;
+    uint32_t length;
+  };
+  /** @brief Mirror → Source 전체 재전송 요청 (뒤에 프레임 이름) */
+  struct ResyncRequest {
+    uint32_t magic;
+    uint32_t nameLen;
+  };
+
+  /** @brief Source 측 감시 프레임 */
+  struct Tracked {
+    std::string name;
+    std::shared_ptr<IFrame> frame;
+    IFrame::CallbackId callbackId = 0;
+    std::unique_ptr<std::atomic<bool>> dirty;
+    std::vector<char> current;  ///< 이번 라운드에 읽은 데이터
+    uint64_t version = 0;
+  };
+
+  /** @brief Source 측 접속 Mirror */
+  struct Client {
+    int fd = -1;
+    bool needsBulk = true;
+    std::vector<std::vector<char>> shadow;  ///< 마지막으로 보낸 상태
+  };
+
+  /** @brief 레코드 1건의 송신 조각 */
+  struct Pending {
+    RecordHeader header;
+    size_t trackedIndex;
+    std::vector<RangeHeader> ranges;
+  };
+
+  bool openSource();
+  bool openMirror();
+  void acceptLoop();
+  void sendLoop();
+  void receiveLoop();
+  bool sendBatch(Client& client, std::vector<Pending>& records);
+  void readResyncRequests(std::vector<Client>& clients);
+  bool requestResync(const std::string& name);
+  static std::vector<RangeHeader> diff(const std::vector<char>& prev,
+                                       const std::vector<char>& cur);
+  static bool writeAll(int fd, std::vector<iovec>& iov);
+  static bool readAll(int fd, void* buf, size_t size);
+  void addStats(const Stats& delta);
+
+  Role role_ = Role::None;
+  std::string host_ = "127.0.0.1";
+  uint16_t port_ = 0;
+  int fd_ = -1;  ///< Source: 대기 소켓, Mirror: 연결 소켓
+  std::atomic<bool> running_{false};
+  std::thread acceptThread_, sendThread_, receiveThread_;
+
+  // Source
+  std::vector<Tracked> tracked_;
+  std::mutex wakeMutex_;
+  std::condition_variable wakeCv_;
+  bool wake_ = false;
+  std::vector<Client> newClients_;  ///< wakeMutex_ 보호
+
+  // Mirror
+  mutable std::mutex versionMutex_;
+  std::unordered_map<std::string, uint64_t> remoteVersions_;
+
+  mutable std::mutex statsMutex_;
+  Stats stats_;
+};
+
+// ------------------- MirrorPort 구현부 -------------------
+
+inline bool MirrorPort::open() {
+  if (running_.load()) return true;
+  if (role_ == Role::Source) return openSource();
+  if (role_ == Role::Mirror) return openMirror();
+  return false;
+}
+
+inline void MirrorPort::close() {
+  running_ = false;
+  if (fd_ >= 0) ::shutdown(fd_, SHUT_RDWR);
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex_);
+    wake_ = true;
+  }
+  wakeCv_.notify_all();
+  for (std::thread* t : {&acceptThread_, &sendThread_, &receiveThread_})
+    if (t->joinable()) t->join();
+  for (auto& t : tracked_) t.frame->removeCallback(t.callbackId);
+  tracked_.clear();
+  for (auto& c : newClients_) ::close(c.fd);
+  newClients_.clear();
+  if (fd_ >= 0) ::close(fd_);
+  fd_ = -1;
+}
+
+inline bool MirrorPort::openSource() {
+  fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (fd_ < 0) return false;
+  int one = 1;
+  ::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port_);
+  socklen_t len = sizeof(addr);
+  if (::bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      ::listen(fd_, 16) != 0 ||
+      ::getsockname(fd_, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  port_ = ntohs(addr.sin_port);
+
+  {
+    std::lock_guard<std::mutex> lock(frames_mutex_);
+    for (const auto& [name, frame] : frames_) {
+      Tracked t;
+      t.name = name;
+      t.frame = frame;
+      t.dirty = std::make_unique<std::atomic<bool>>(false);
+      tracked_.push_back(std::move(t));
+    }
+  }
+  // 이름순 정렬: 양쪽 로그/디버깅 시 레코드 순서가 안정적
+  std::sort(tracked_.begin(), tracked_.end(),
+            [](const Tracked& a, const Tracked& b) { return a.name < b.name; });
+  for (auto& t : tracked_) {
+    std::atomic<bool>* dirty = t.dirty.get();
+    t.callbackId = t.frame->addCallback(
+        [this, dirty](const IFrame&) {
+          if (dirty->exchange(true, std::memory_order_acq_rel)) return;
+          {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wake_ = true;
+          }
+          wakeCv_.notify_one();
+        },
+        CallbackPolicy::Direct);
+  }
+
+  running_ = true;
+  acceptThread_ = std::thread([this] { acceptLoop(); });
+  sendThread_ = std::thread([this] { sendLoop(); });
+  return true;
+}
+
+inline bool MirrorPort::openMirror() {
+  fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (fd_ < 0) return false;
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port_);
+  if (::inet_pton(AF_INET, host_.c_str(), &addr.sin_addr) != 1 ||
+      ::connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  running_ = true;
+  receiveThread_ = std::thread([this] { receiveLoop(); });
+  return true;
+}
+
+inline void MirrorPort::acceptLoop() {
+  while (running_.load()) {
+    pollfd pfd{fd_, POLLIN, 0};
+    if (::poll(&pfd, 1, 100) <= 0) continue;
+    const int cfd = ::accept(fd_, nullptr, nullptr);
+    if (cfd < 0) continue;
+    int one = 1;
+    ::setsockopt(cfd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    {
+      std::lock_guard<std::mutex> lock(wakeMutex_);
+      Client c;
+      c.fd = cfd;
+      newClients_.push_back(std::move(c));
+      wake_ = true;
+    }
+    wakeCv_.notify_one();
+  }
+}
+
+inline void MirrorPort::sendLoop() {
+  std::vector<Client> clients;
+  std::vector<size_t> dirty;
+  while (running_.load()) {
+    {
+      std::unique_lock<std::mutex> lock(wakeMutex_);
+      wakeCv_.wait_for(lock, kResyncPoll, [this] { return wake_; });
+      wake_ = false;
+      for (auto& c : newClients_) clients.push_back(std::move(c));
+      newClients_.clear();
+    }
+    if (!running_.load()) break;
+    readResyncRequests(clients);
+
+    // 변경된 프레임 (+ bulk가 필요한 Mirror가 있으면 전체) 를 한 번씩 읽음
+    bool anyBulk = false;
+    for (const auto& c : clients) anyBulk |= c.needsBulk;
+    dirty.clear();
+    for (size_t i = 0; i < tracked_.size(); ++i) {
+      const bool changed =
+          tracked_[i].dirty->exchange(false, std::memory_order_acq_rel);
+      if (!changed && !anyBulk) continue;
+      Tracked& t = tracked_[i];
+      t.frame->readRawData([&](const char* p, size_t n) {
+        t.current.assign(p, p + n);
+        t.version = t.frame->version();
+      });
+      dirty.push_back(i);
+    }
+
+    for (auto it = clients.begin(); it != clients.end();) {
+      Client& c = *it;
+      std::vector<Pending> records;
+      if (c.shadow.size() != tracked_.size()) c.shadow.resize(tracked_.size());
+      for (size_t i : dirty) {
+        Tracked& t = tracked_[i];
+        Pending rec{};
+        rec.trackedIndex = i;
+        rec.header.version = t.version;
+        rec.header.frameSize = static_cast<uint32_t>(t.current.size());
+        rec.header.nameLen = static_cast<uint16_t>(t.name.size());
+        if (c.needsBulk || c.shadow[i].size() != t.current.size()) {
+          rec.header.kind = kFull;
+          rec.ranges.push_back({0, static_cast<uint32_t>(t.current.size())});
+        } else {
+          rec.header.kind = kDelta;
+          rec.ranges = diff(c.shadow[i], t.current);
+          if (rec.ranges.empty()) continue;  // 내용 변화 없음
+        }
+        rec.header.ranges = static_cast<uint16_t>(rec.ranges.size());
+        records.push_back(std::move(rec));
+      }
+      c.needsBulk = false;
+      if (!records.empty() && !sendBatch(c, records)) {
+        ::close(c.fd);  // 연결 끊김: 재접속 시 다시 bulk부터 시작
+        it = clients.erase(it);
+        continue;
+      }
+      for (const auto& rec : records)
+        c.shadow[rec.trackedIndex] = tracked_[rec.trackedIndex].current;
+      ++it;
+    }
+  }
+  for (auto& c : clients) ::close(c.fd);
+}
+
+inline bool MirrorPort::sendBatch(Client& client,
+                                  std::vector<Pending>& records) {
+  BatchHeader bh{kMagic, static_cast<uint32_t>(records.size()), 0};
+  std::vector<iovec> iov;
+  iov.reserve(1 + records.size() * 4);
+  iov.push_back({&bh, sizeof(bh)});
+  Stats delta;
+  for (auto& rec : records) {
+    Tracked& t = tracked_[rec.trackedIndex];
+    iov.push_back({&rec.header, sizeof(RecordHeader)});
+    iov.push_back({const_cast<char*>(t.name.data()), t.name.size()});
+    iov.push_back(
+        {rec.ranges.data(), rec.ranges.size() * sizeof(RangeHeader)});
+    bh.bytes += static_cast<uint32_t>(sizeof(RecordHeader) + t.name.size() +
+                                      rec.ranges.size() * sizeof(RangeHeader));
+    for (const auto& r : rec.ranges) {
+      iov.push_back({t.current.data() + r.offset, r.length});
+      bh.bytes += r.length;
+    }
+    (rec.header.kind == kFull ? delta.bulkRecords : delta.deltaRecords)++;
+  }
+  delta.batches = 1;
+  delta.bytes = sizeof(bh) + bh.bytes;
+  if (!writeAll(client.fd, iov)) return false;
+  addStats(delta);
+  return true;
+}
+
+/**
+ * @brief 접속한 Mirror들의 재동기화 요청 처리 (블록하지 않음)
+ *
+ * 요청된 프레임의 shadow를 비우고 dirty로 표시하므로, 같은 라운드에서
+ * 그 Mirror에는 전체 레코드가, 다른 Mirror에는 (변화가 없으면) 아무것도
+ * 가지 않습니다. 연결이 끊긴 Mirror는 여기서 정리됩니다.
+ */
+inline void MirrorPort::readResyncRequests(std::vector<Client>& clients) {
+  uint64_t received = 0;
+  std::string name;
+  for (auto it = clients.begin(); it != clients.end();) {
+    Client& c = *it;
+    if (c.shadow.size() != tracked_.size()) c.shadow.resize(tracked_.size());
+    bool alive = true;
+    pollfd pfd{c.fd, POLLIN, 0};
+    while (::poll(&pfd, 1, 0) > 0) {
+      ResyncRequest rq;
+      alive = (pfd.revents & POLLIN) && readAll(c.fd, &rq, sizeof(rq)) &&
+              rq.magic == kResyncMagic && rq.nameLen <= UINT16_MAX;
+      if (alive) {
+        name.resize(rq.nameLen);
+        alive = readAll(c.fd, name.data(), name.size());
+      }
+      if (!alive) break;
+      auto t = std::lower_bound(
+          tracked_.begin(), tracked_.end(), name,
+          [](const Tracked& a, const std::string& n) { return a.name < n; });
+      if (t == tracked_.end() || t->name != name) continue;
+      c.shadow[t - tracked_.begin()].clear();  // 크기 불일치 → 전체 레코드
+      t->dirty->store(true, std::memory_order_release);
+      ++received;
+    }
+    if (!alive) {
+      ::close(c.fd);
+      it = clients.erase(it);
+      continue;
+    }
+    ++it;
+  }
+  if (received) {
+    Stats delta;
+    delta.resyncs = received;
+    addStats(delta);
+  }
+}
+
+/**
+ * @brief Mirror → Source 전체 재전송 요청 송신
+ */
+inline bool MirrorPort::requestResync(const std::string& name) {
+  ResyncRequest rq{kResyncMagic, static_cast<uint32_t>(name.size())};
+  std::vector<iovec> iov{{&rq, sizeof(rq)},
+                         {const_cast<char*>(name.data()), name.size()}};
+  return writeAll(fd_, iov);
+}
+
+inline std::vector<MirrorPort::RangeHeader> MirrorPort::diff(
+    const std::vector<char>& prev, const std::vector<char>& cur) {
+  std::vector<RangeHeader> ranges;
+  const size_t n = cur.size();
+  size_t i = 0;
+  while (i < n) {
+    // 8바이트 단위로 같은 구간을 빠르게 건너뜀
+    while (i + 8 <= n && std::memcmp(&prev[i], &cur[i], 8) == 0) i += 8;
+    while (i < n && prev[i] == cur[i]) ++i;
+    if (i >= n) break;
+    size_t end = i + 1;
+    size_t same = 0;
+    for (size_t j = end; j < n && same < kMergeGap; ++j) {
+      if (prev[j] == cur[j]) {
+        ++same;
+      } else {
+        same = 0;
+        end = j + 1;
+      }
+    }
+    ranges.push_back(
+        {static_cast<uint32_t>(i), static_cast<uint32_t>(end - i)});
+    i = end;
+  }
+  return ranges;
+}
+
+inline bool MirrorPort::writeAll(int fd, std::vector<iovec>& iov) {
+  size_t first = 0;
+  while (first < iov.size()) {
+    const int count =
+        static_cast<int>(std::min<size_t>(iov.size() - first, IOV_MAX));
+    ssize_t n = ::writev(fd, &iov[first], count);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    // 부분 송신: 보낸 만큼 iovec을 전진
+    while (n > 0 && first < iov.size()) {
+      if (static_cast<size_t>(n) >= iov[first].iov_len) {
+        n -= static_cast<ssize_t>(iov[first].iov_len);
+        ++first;
+      } else {
+        iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + n;
+        iov[first].iov_len -= static_cast<size_t>(n);
+        n = 0;
+      }
+    }
+    while (first < iov.size() && iov[first].iov_len == 0) ++first;
+  }
+  return true;
+}
+
+inline bool MirrorPort::readAll(int fd, void* buf, size_t size) {
+  char* p = static_cast<char*>(buf);
+  while (size > 0) {
+    const ssize_t n = ::recv(fd, p, size, 0);
+    if (n == 0) return false;
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    p += n;
+    size -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+inline void MirrorPort::receiveLoop() {
+  std::vector<char> payload;
+  std::unordered_map<std::string, std::shared_ptr<IFrame>> cache;
+  std::vector<std::shared_ptr<IFrame>> touched;
+  std::unordered_set<std::string> resyncPending;  ///< 재전송 요청한 프레임
+  while (running_.load()) {
+    BatchHeader bh;
+    if (!readAll(fd_, &bh, sizeof(bh)) || bh.magic != kMagic) break;
+    payload.resize(bh.bytes);
+    if (!readAll(fd_, payload.data(), payload.size())) break;
+
+    Stats delta;
+    delta.batches = 1;
+    delta.bytes = sizeof(bh) + bh.bytes;
+    touched.clear();
+    size_t pos = 0;
+    bool malformed = false;
+    for (uint32_t r = 0; r < bh.records && !malformed; ++r) {
+      RecordHeader rh;
+      if (pos + sizeof(rh) > payload.size()) {
+        malformed = true;
+        break;
+      }
+      std::memcpy(&rh, &payload[pos], sizeof(rh));
+      pos += sizeof(rh);
+      const size_t rangeBytes = size_t(rh.ranges) * sizeof(RangeHeader);
+      if (pos + rh.nameLen + rangeBytes > payload.size()) {
+        malformed = true;
+        break;
+      }
+      const std::string name(&payload[pos], rh.nameLen);
+      pos += rh.nameLen;
+      std::vector<RangeHeader> ranges(rh.ranges);
+      std::memcpy(ranges.data(), &payload[pos], rangeBytes);
+      pos += rangeBytes;
+      size_t dataBytes = 0;
+      for (const auto& rg : ranges) {
+        if (size_t(rg.offset) + rg.length > rh.frameSize) malformed = true;
+        dataBytes += rg.length;
+      }
+      if (malformed || pos + dataBytes > payload.size()) {
+        malformed = true;
+        break;
+      }
+      const char* data = &payload[pos];
+      pos += dataBytes;
+
+      auto it = cache.find(name);
+      if (it == cache.end()) it = cache.emplace(name, findFrame(name)).first;
+      const std::shared_ptr<IFrame>& frame = it->second;
+      uint64_t& last = [&]() -> uint64_t& {
+        std::lock_guard<std::mutex> lock(versionMutex_);
+        return remoteVersions_[name];
+      }();
+      const bool stale = rh.kind == kDelta && rh.version <= last;
+      bool applied = false;
+      if (frame && !stale) {
+        frame->writeRawData([&](char* dst, size_t size) {
+          if (size != rh.frameSize) return;
+          const char* src = data;
+          for (const auto& rg : ranges) {
+            std::memcpy(dst + rg.offset, src, rg.length);
+            src += rg.length;
+          }
+          applied = true;
+        });
+      }
+      if (!applied) {
+        ++delta.rejected;
+        // Source의 shadow는 이미 전진: 전체 재전송으로 다시 맞춤
+        if (resyncPending.insert(name).second && requestResync(name))
+          ++delta.resyncs;
+        continue;
+      }
+      resyncPending.erase(name);
+      {
+        std::lock_guard<std::mutex> lock(versionMutex_);
+        last = rh.version;
+      }
+      (rh.kind == kFull ? delta.bulkRecords : delta.deltaRecords)++;
+      if (std::find(touched.begin(), touched.end(), frame) == touched.end())
+        touched.push_back(frame);
+    }
+    // 배치 적용 후 프레임당 한 번만 publish
+    for (auto& frame : touched) frame->notifyCallbacks();
+    delta.publishes = touched.size();
+    addStats(delta);
+    if (malformed) break;
+  }
+  running_ = false;
+}
+
+inline uint64_t MirrorPort::remoteVersion(const std::string& frameName) const {
+  std::lock_guard<std::mutex> lock(versionMutex_);
+  auto it = remoteVersions_.find(frameName);
+  return it == remoteVersions_.end() ? 0 : it->second;
+}
+
+inline void MirrorPort::addStats(const Stats& d) {
+  std::lock_guard<std::mutex> lock(statsMutex_);
+  stats_.batches += d.batches;
+  stats_.bulkRecords += d.bulkRecords;
+  stats_.deltaRecords += d.deltaRecords;
+  stats_.bytes += d.bytes;
+  stats_.publishes += d.publishes;
+  stats_.rejected += d.rejected;
+  stats_.resyncs += d.resyncs;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_PORT_MIRRORPORT_HPP
@@ -37,10 +37,12 @@
 #define NEXUM_COM_EXTERNAL_INTERFACE_PORTBASE_HPP
 
 #include <any>
+#include <cstddef>
 #include <cstring>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -49,7 +51,8 @@
 #include "../bus_Factory/AutoRegister.hpp"
 #include "../bus_Factory/FrameBus.hpp"
 #include "../frame/IFrame.h"
-#include "../port/IPort.h"
+#include "../frame/ZeroCopy.hpp"
+#include "../port/IPortDefaults.hpp"
 
 /**
  * @brief IPort 기반 외부 접점(Port) 구현을 위한 템플릿 베이스 클래스
@@ -136,6 +139,35 @@ class PortBase : public AutoRegister<Derived, IPort> {
   bool setRawDataToFrameWithPublish(const std::string& frameName,
                                     const char* data, size_t size) override;
 
+  // ------------------- I/O 버퍼 직렬화 -------------------
+
+  /**
+   * @brief 프레임을 I/O 버퍼에 직접 직렬화 (송신 경로)
+   * @param frameName 프레임 이름
+   * @param out 출력 버퍼 (소켓/링버퍼 등)
+   * @return 기록된 바이트 수 (실패 시 0)
+   */
+  size_t serializeFrameInto(const std::string& frameName,
+                            std::span<std::byte> out) override;
+
+  /**
+   * @brief I/O 버퍼로부터 프레임 역직렬화 (수신 경로, Publish 없음)
+   * @param frameName 프레임 이름
+   * @param in 수신 데이터
+   * @return 성공 여부
+   */
+  bool deserializeFrameFrom(const std::string& frameName,
+                            std::span<const std::byte> in) override;
+
+  /**
+   * @brief I/O 버퍼로부터 프레임 역직렬화 및 즉시 Publish
+   * @param frameName 프레임 이름
+   * @param in 수신 데이터
+   * @return 성공 여부
+   */
+  bool deserializeFrameFromWithPublish(const std::string& frameName,
+                                       std::span<const std::byte> in) override;
+
   // ------------------- 신호/데이터 조회 -------------------
 
   /**
@@ -178,6 +210,39 @@ class PortBase : public AutoRegister<Derived, IPort> {
       const std::string& frameName,
       std::function<void(const char*, size_t)> cb) override;
 
+  /**
+   * @brief 프레임 데이터 콜백 구독 (공유 실행기, 구독별 순서 보장)
+   * @param frameName 프레임 이름
+   * @param executor 콜백을 실행할 실행기
+   * @param cb 데이터 수신시 호출될 콜백
+   * @param attr 우선순위 / 마감 속성
+   * @return uint64_t 콜백 인스턴스 ID
+   */
+  uint64_t subscribeFrameOn(
+      const std::string& frameName, IExecutor& executor,
+      std::function<void(const char*, size_t)> cb,
+      const DispatchAttr& attr = {}) override;
+
+  /**
+   * @brief 프레임 제로카피 뷰 구독 (Direct, 역직렬화 없이 이름으로 읽음)
+   *
+   * 구독 시점의 신호 구성으로 스키마를 만들고 publish마다 ZeroCopyView로
+   * 콜백을 호출합니다.
+   * - kViewStackBytes 초과: readRawData의 읽기 락 안에서 프레임 데이터
+   *   위에 바로 뷰를 만듭니다 (복사 없음, 콜백 동안 쓰기가 막힘)
+   * - kViewStackBytes 이하: 락 잡는 비용보다 싸므로 seqlock으로 검증한
+   *   스택 복사본 위의 뷰를 넘깁니다
+   * - Atomic 신호가 있는 프레임은 락 없이 바뀔 수 있으므로 항상 복사
+   * @note 콜백에서 같은 프레임에 쓰면 안 됩니다 (읽기 락 보유 시 교착).
+   * @param frameName 프레임 이름
+   * @param cb 데이터 수신시 호출될 콜백 (뷰는 콜백 안에서만 유효)
+   * @return uint64_t 콜백 인스턴스 ID (프레임이 없거나 신호 구성으로
+   *         스키마를 만들 수 없으면 0)
+   */
+  uint64_t subscribeFrameView(
+      const std::string& frameName,
+      std::function<void(const ZeroCopyView&)> cb) override;
+
   /**
    * @brief 프레임 콜백 구독 해제
    * @param callbackId 구독시 반환받은 콜백 인스턴스 ID
@@ -185,6 +250,9 @@ class PortBase : public AutoRegister<Derived, IPort> {
   void unsubscribeFrame(uint64_t callbackId) override;
 
  protected:
+  /** @brief subscribeFrameView가 스택에 복사하는 최대 프레임 크기 */
+  static constexpr size_t kViewStackBytes = 512;
+
   /**
    * @brief 등록된 프레임을 이름으로 찾아 반환 (없으면 nullptr)
    * @param name 프레임 이름
@@ -272,6 +340,9 @@ inline bool PortBase<Derived>::setRawDataToFrame(const std::string& frameName,
       ok = true;
     }
   });
+  if (ok)
+    IFrame::emitFrameEvent(*frame, FrameEvent::PortRx, instanceName_,
+                           std::as_bytes(std::span(data, size)));
   return ok;
 }
 
@@ -287,10 +358,57 @@ inline bool PortBase<Derived>::setRawDataToFrameWithPublish(
       ok = true;
     }
   });
-  if (ok) frame->notifyCallbacks();
+  if (ok) {
+    IFrame::emitFrameEvent(*frame, FrameEvent::PortRx, instanceName_,
+                           std::as_bytes(std::span(data, size)));
+    frame->notifyCallbacks();
+  }
   return ok;
 }
 
+template <typename Derived>
+inline size_t PortBase<Derived>::serializeFrameInto(
+    const std::string& frameName, std::span<std::byte> out) {
+  auto frame = findFrame(frameName);
+  if (!frame) return 0;
+  try {
+    const size_t n = frame->serializeInto(out);
+    IFrame::emitFrameEvent(*frame, FrameEvent::PortTx, instanceName_,
+                           out.first(n));
+    return n;
+  } catch (...) {
+    return 0;
+  }
+}
+
+template <typename Derived>
+inline bool PortBase<Derived>::deserializeFrameFrom(
+    const std::string& frameName, std::span<const std::byte> in) {
+  auto frame = findFrame(frameName);
+  if (!frame) return false;
+  try {
+    frame->deserializeFrom(in);
+    IFrame::emitFrameEvent(*frame, FrameEvent::PortRx, instanceName_, in);
+    return true;
+  } catch (...) {
+    return false;
+  }
+}
+
+template <typename Derived>
+inline bool PortBase<Derived>::deserializeFrameFromWithPublish(
+    const std::string& frameName, std::span<const std::byte> in) {
+  auto frame = findFrame(frameName);
+  if (!frame) return false;
+  // 수신 바이트를 Publish보다 먼저 기록
+  IFrame::emitFrameEvent(*frame, FrameEvent::PortRx, instanceName_, in);
+  try {
+    return frame->deserializeFromWithPublish(in);
+  } catch (...) {
+    return false;
+  }
+}
+
 template <typename Derived>
 inline std::any PortBase<Derived>::getSignalFromFrameAsAny(
     const std::string& frameName, const std::string& signal) {
@@ -304,7 +422,15 @@ inline bool PortBase<Derived>::getRawDataFromFrame(
     const std::string& frameName, std::function<void(const char*, size_t)> cb) {
   auto frame = findFrame(frameName);
   if (!frame) return false;
-  frame->readRawData(cb);
+  if (!IFrame::frameTap()) {
+    frame->readRawData(cb);
+    return true;
+  }
+  frame->readRawData([&](const char* p, size_t n) {
+    IFrame::emitFrameEvent(*frame, FrameEvent::PortTx, instanceName_,
+                           std::as_bytes(std::span(p, n)));
+    cb(p, n);
+  });
   return true;
 }
 
@@ -339,6 +465,74 @@ inline uint64_t PortBase<Derived>::subscribeFrameDirect(
   return id;
 }
 
+template <typename Derived>
+inline uint64_t PortBase<Derived>::subscribeFrameOn(
+    const std::string& frameName, IExecutor& executor,
+    std::function<void(const char*, size_t)> cb, const DispatchAttr& attr) {
+  auto frame = findFrame(frameName);
+  if (!frame) return 0;
+  auto wrapper = [cb](const std::vector<uint8_t>& data, size_t sz) {
+    cb(reinterpret_cast<const char*>(data.data()), sz);
+  };
+  uint64_t id = frame->addSnapshotCallback(wrapper, executor, attr);
+  {
+    std::lock_guard<std::mutex> lock(cb_mutex_);
+    callback_map_[id] = frame;
+  }
+  return id;
+}
+
+template <typename Derived>
+inline uint64_t PortBase<Derived>::subscribeFrameView(
+    const std::string& frameName,
+    std::function<void(const ZeroCopyView&)> cb) {
+  auto frame = findFrame(frameName);
+  if (!frame) return 0;
+  std::shared_ptr<const ZeroCopySchema> schema;
+  try {
+    schema = std::make_shared<const ZeroCopySchema>(frame->signalEntries(),
+                                                    frame->size());
+  } catch (const std::exception&) {
+    return 0;  // 스키마로 표현할 수 없는 신호 구성
+  }
+  bool lockFreeSignals = false;
+  for (const auto& e : frame->signalEntries())
+    lockFreeSignals |= e.desc.access == SignalAccess::Atomic;
+  auto wrapper = [schema, cb, lockFreeSignals](const IFrame& f) {
+    const size_t size = schema->payloadSize();
+    if (size > kViewStackBytes && !lockFreeSignals) {  // 원본 위의 뷰
+      f.readRawData([&](const char* p, size_t n) {
+        if (n != size) return;  // 구독 이후 크기가 바뀐 프레임
+        cb(ZeroCopyView(*schema, std::as_bytes(std::span(p, n))));
+      });
+      return;
+    }
+    std::byte stack[kViewStackBytes];
+    std::vector<std::byte> heap;
+    std::span<std::byte> buf(stack, size);
+    if (size > kViewStackBytes) {
+      heap.resize(size);
+      buf = heap;
+    }
+    uint64_t version;
+    if (f.size() != size || !f.tryReadVersioned(buf, version)) {
+      size_t copied = 0;
+      f.readRawData([&](const char* p, size_t n) {
+        copied = n < size ? n : size;
+        std::memcpy(buf.data(), p, copied);
+      });
+      if (copied != size) return;  // 구독 이후 크기가 바뀐 프레임
+    }
+    cb(ZeroCopyView(*schema, buf));
+  };
+  uint64_t id = frame->addCallback(wrapper, CallbackPolicy::Direct);
+  {
+    std::lock_guard<std::mutex> lock(cb_mutex_);
+    callback_map_[id] = frame;
+  }
+  return id;
+}
+
 template <typename Derived>
 inline void PortBase<Derived>::unsubscribeFrame(uint64_t callbackId) {
   std::shared_ptr<IFrame> frame;
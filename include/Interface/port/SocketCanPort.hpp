@@ -0,0 +1,456 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_PORT_SOCKETCANPORT_HPP
+#define NEXUM_COM_EXTERNAL_PORT_SOCKETCANPORT_HPP
+
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../frame/PublishBatch.hpp"
+#include "PortBase.hpp"
+
+/**
+ * @brief SocketCAN(CAN_RAW) 포트 (Classic CAN / CAN FD)
+ *
+ * CAN ID ↔ 프레임 매핑을 등록한 뒤 open()하면,
+ * - 수신 매핑에서 커널 CAN_RAW_FILTER를 만들어 불필요한 ID를 커널에서 거르고
+ * - recvmmsg로 여러 CAN 프레임을 한 번에 받아
+ * - 표준 ID는 2048칸 직접 색인 테이블, 확장 ID는 해시맵으로 찾은 프레임에
+ *   수신 버퍼를 그대로 deserializeFrom(할당 없음)합니다.
+ * 한 수신 배치는 PublishBatch로 묶여 배치 안에서 여러 번 받은 프레임도
+ * 최종 값으로 한 번만 publish됩니다.
+ *
+ * 페이로드가 프레임 크기보다 길면 앞부분만 사용하고(CAN FD DLC 패딩),
+ * 짧으면 버리고 lengthErrors로 집계합니다.
+ *
+ * 사용: configure("vcan0", fd) → bindRx/bindTx(...) → open()
+ *
+ * @note 매핑 등록은 open 이전에 한 스레드에서 수행해야 합니다.
+ *       같은 프레임을 수신과 자동 송신에 함께 매핑하면 수신 값이 다시
+ *       송신되므로 피하십시오.
+ */
+class SocketCanPort : public PortBase<SocketCanPort> {
+ public:
+  /**
+   * @brief 송수신 통계
+   */
+  struct Stats {
+    uint64_t batches = 0;       ///< recvmmsg 호출 중 1건 이상 받은 수
+    uint64_t received = 0;      ///< 수신 CAN 프레임 수
+    uint64_t delivered = 0;     ///< 프레임에 반영한 수
+    uint64_t unknownIds = 0;    ///< 매핑 없는 ID (커널 필터 미적용 시)
+    uint64_t lengthErrors = 0;  ///< 페이로드가 프레임보다 짧음
+    uint64_t transmitted = 0;   ///< 송신 성공 수
+    uint64_t txErrors = 0;      ///< 송신 실패 수
+  };
+
+  /** @brief recvmmsg 한 번에 받을 최대 CAN 프레임 수 */
+  static constexpr size_t kBatch = 32;
+
+  explicit SocketCanPort(const std::string& instanceName)
+      : PortBase(instanceName) {
+    standard_.fill(kNone);
+  }
+  ~SocketCanPort() override { close(); }
+
+  static std::string staticName() { return "SocketCanPort"; }
+  std::string type() const override { return "socketcan"; }
+
+  /**
+   * @brief 인터페이스 설정 (open 이전)
+   * @param ifname CAN 인터페이스 이름 (예: "can0", "vcan0")
+   * @param fd CAN FD 프레임 송수신 여부
+   */
+  void configure(const std::string& ifname, bool fd = false) {
+    ifname_ = ifname;
+    fd_enabled_ = fd;
+  }
+
+  /**
+   * @brief 수신 매핑 등록 (open 이전, 프레임도 연결됨)
+   * @param frameName FrameBus 프레임 이름
+   * @param canId CAN ID
+   * @param extended 29비트 확장 ID 여부
+   * @return 프레임이 없거나 ID가 범위를 넘으면 false
+   */
+  bool bindRx(const std::string& frameName, uint32_t canId,
+              bool extended = false);
+
+  /**
+   * @brief 송신 매핑 등록 (open 이전, 프레임도 연결됨)
+   * @param frameName FrameBus 프레임 이름
+   * @param canId CAN ID
+   * @param extended 29비트 확장 ID 여부
+   * @param sendOnPublish 프레임이 publish될 때마다 자동 송신
+   * @return 프레임이 없거나 ID가 범위를 넘으면 false
+   */
+  bool bindTx(const std::string& frameName, uint32_t canId,
+              bool extended = false, bool sendOnPublish = true);
+
+  /**
+   * @brief 소켓 열기 (필터 설치 후 수신 스레드 시작)
+   * @return 성공 여부 (인터페이스 없음, FD 미지원 등은 false)
+   */
+  bool open() override;
+
+  /**
+   * @brief 수신 스레드 종료 및 소켓/구독 해제 (매핑은 유지)
+   */
+  void close() override;
+
+  /**
+   * @brief 송신 매핑된 프레임의 현재 값을 송신
+   * @return 매핑 없음/소켓 미개방/쓰기 실패 시 false
+   */
+  bool transmit(const std::string& frameName);
+
+  /**
+   * @brief 커널 필터 설치 여부 (매핑이 CAN_RAW_FILTER_MAX를 넘으면 false)
+   */
+  bool kernelFiltered() const { return kernelFiltered_; }
+
+  /**
+   * @brief 송수신 통계
+   */
+  Stats stats() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return stats_;
+  }
+
+ private:
+  static constexpr uint16_t kNone = 0xFFFF;
+
+  /** @brief 수신 매핑 (frameSize는 bind 시점의 serializedSize) */
+  struct RxEntry {
+    uint32_t canId;
+    bool extended;
+    std::shared_ptr<IFrame> frame;
+    size_t frameSize;
+  };
+
+  /** @brief 송신 매핑 */
+  struct TxEntry {
+    uint32_t canId;
+    bool extended;
+    bool sendOnPublish;
+    std::shared_ptr<IFrame> frame;
+    IFrame::CallbackId callbackId = 0;
+  };
+
+  static bool validId(uint32_t canId, bool extended) {
+    return canId <= (extended ? CAN_EFF_MASK : CAN_SFF_MASK);
+  }
+  static uint32_t key(uint32_t canId, bool extended) {
+    return extended ? (canId | CAN_EFF_FLAG) : canId;
+  }
+  /** @brief CAN FD DLC로 표현 가능한 길이로 올림 (패딩은 0) */
+  static size_t fdLength(size_t len) {
+    constexpr size_t kSizes[] = {12, 16, 20, 24, 32, 48, 64};
+    if (len <= CAN_MAX_DLEN) return len;
+    for (size_t s : kSizes)
+      if (len <= s) return s;
+    return CANFD_MAX_DLEN;
+  }
+
+  void installFilters();
+  void receiveLoop();
+  void dispatch(const canfd_frame* frames, const mmsghdr* msgs, size_t n,
+                Stats& delta);
+  bool send(TxEntry& entry);
+  void addStats(const Stats& delta);
+
+  std::string ifname_;
+  bool fd_enabled_ = false;
+  int fd_ = -1;
+  std::atomic<bool> running_{false};
+  std::thread receiveThread_;
+  bool kernelFiltered_ = false;
+
+  std::vector<RxEntry> rx_;
+  std::array<uint16_t, CAN_SFF_MASK + 1> standard_;  ///< 표준 ID → rx_ 색인
+  std::unordered_map<uint32_t, uint16_t> extended_;  ///< 확장 ID → rx_ 색인
+
+  std::mutex txMutex_;  ///< 송신 버퍼 / 소켓 쓰기 보호
+  std::unordered_map<std::string, TxEntry> tx_;
+
+  mutable std::mutex statsMutex_;
+  Stats stats_;
+};
+
+// ------------------- SocketCanPort 구현부 -------------------
+
+inline bool SocketCanPort::bindRx(const std::string& frameName,
+                                  uint32_t canId, bool extended) {
+  if (running_.load() || !validId(canId, extended) || rx_.size() >= kNone)
+    return false;
+  if (!connectFrame(frameName)) return false;
+  auto frame = findFrame(frameName);
+  if (!frame) return false;
+  uint16_t index = static_cast<uint16_t>(rx_.size());
+  if (extended) {
+    auto [it, inserted] = extended_.try_emplace(canId, index);
+    if (!inserted) index = it->second;
+  } else if (standard_[canId] != kNone) {
+    index = standard_[canId];
+  } else {
+    standard_[canId] = index;
+  }
+  const RxEntry entry{canId, extended, frame, frame->serializedSize()};
+  if (index == rx_.size()) {
+    rx_.push_back(entry);
+  } else {
+    rx_[index] = entry;  // 같은 ID 재등록: 마지막 매핑 사용
+  }
+  return true;
+}
+
+inline bool SocketCanPort::bindTx(const std::string& frameName,
+                                  uint32_t canId, bool extended,
+                                  bool sendOnPublish) {
+  if (running_.load() || !validId(canId, extended)) return false;
+  if (!connectFrame(frameName)) return false;
+  auto frame = findFrame(frameName);
+  if (!frame) return false;
+  std::lock_guard<std::mutex> lock(txMutex_);
+  tx_[frameName] = TxEntry{canId, extended, sendOnPublish, frame};
+  return true;
+}
+
+inline bool SocketCanPort::open() {
+  if (running_.load()) return true;
+  fd_ = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
+  if (fd_ < 0) return false;
+  ifreq ifr{};
+  std::strncpy(ifr.ifr_name, ifname_.c_str(), IFNAMSIZ - 1);
+  sockaddr_can addr{};
+  addr.can_family = AF_CAN;
+  int one = 1;
+  bool ok = ::ioctl(fd_, SIOCGIFINDEX, &ifr) == 0;
+  if (ok) addr.can_ifindex = ifr.ifr_ifindex;
+  if (ok && fd_enabled_)
+    ok = ::setsockopt(fd_, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &one,
+                      sizeof(one)) == 0;
+  if (ok) installFilters();
+  if (ok)
+    ok = ::bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+  if (!ok) {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+
+  // 콜백 등록은 txMutex_ 밖에서 (콜백 락 → txMutex_ 순서 유지)
+  for (auto& [name, entry] : tx_) {
+    if (!entry.sendOnPublish) continue;
+    TxEntry* e = &entry;  // unordered_map 노드 주소는 안정적
+    entry.callbackId = entry.frame->addCallback(
+        [this, e](const IFrame&) {
+          std::lock_guard<std::mutex> lock(txMutex_);
+          send(*e);
+        },
+        CallbackPolicy::Direct);
+  }
+  running_ = true;
+  receiveThread_ = std::thread([this] { receiveLoop(); });
+  return true;
+}
+
+inline void SocketCanPort::close() {
+  running_ = false;
+  if (receiveThread_.joinable()) receiveThread_.join();
+  for (auto& [name, entry] : tx_) {
+    if (entry.callbackId) entry.frame->removeCallback(entry.callbackId);
+    entry.callbackId = 0;
+  }
+  std::lock_guard<std::mutex> lock(txMutex_);
+  if (fd_ >= 0) ::close(fd_);
+  fd_ = -1;
+}
+
+/**
+ * @brief 수신 매핑으로 커널 필터 구성 (매핑이 없으면 전부 차단)
+ */
+inline void SocketCanPort::installFilters() {
+  std::vector<can_filter> filters;
+  filters.reserve(rx_.size());
+  for (const auto& e : rx_) {
+    can_filter f{};
+    f.can_id = key(e.canId, e.extended);
+    f.can_mask = CAN_EFF_FLAG | CAN_RTR_FLAG |
+                 (e.extended ? CAN_EFF_MASK : CAN_SFF_MASK);
+    filters.push_back(f);
+  }
+  if (filters.size() > CAN_RAW_FILTER_MAX) {
+    kernelFiltered_ = false;  // 기본 필터(전체 수신) + 사용자 공간 테이블
+    return;
+  }
+  kernelFiltered_ =
+      ::setsockopt(fd_, SOL_CAN_RAW, CAN_RAW_FILTER,
+                   filters.empty() ? nullptr : filters.data(),
+                   static_cast<socklen_t>(filters.size() *
+                                          sizeof(can_filter))) == 0;
+}
+
+inline void SocketCanPort::receiveLoop() {
+  // 배치 버퍼는 스레드 시작 시 한 번만 할당
+  std::vector<canfd_frame> frames(kBatch);
+  std::vector<iovec> iov(kBatch);
+  std::vector<mmsghdr> msgs(kBatch);
+  for (size_t i = 0; i < kBatch; ++i) {
+    iov[i] = {&frames[i], sizeof(canfd_frame)};
+    msgs[i] = {};
+    msgs[i].msg_hdr.msg_iov = &iov[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  while (running_.load()) {
+    pollfd pfd{fd_, POLLIN, 0};
+    if (::poll(&pfd, 1, 100) <= 0) continue;  // 종료 확인 주기
+    const int n = ::recvmmsg(fd_, msgs.data(), kBatch, MSG_DONTWAIT, nullptr);
+    if (n <= 0) continue;
+    Stats delta;
+    delta.batches = 1;
+    delta.received = static_cast<uint64_t>(n);
+    {
+      PublishBatch batch;  // 배치 내 같은 프레임은 한 번만 publish
+      dispatch(frames.data(), msgs.data(), static_cast<size_t>(n), delta);
+    }
+    addStats(delta);
+  }
+}
+
+inline void SocketCanPort::dispatch(const canfd_frame* frames,
+                                    const mmsghdr* msgs, size_t n,
+                                    Stats& delta) {
+  for (size_t i = 0; i < n; ++i) {
+    const canfd_frame& cf = frames[i];
+    if (msgs[i].msg_len != CAN_MTU && msgs[i].msg_len != CANFD_MTU) continue;
+    if (cf.can_id & (CAN_ERR_FLAG | CAN_RTR_FLAG)) continue;
+    uint16_t index = kNone;
+    if (cf.can_id & CAN_EFF_FLAG) {
+      auto it = extended_.find(cf.can_id & CAN_EFF_MASK);
+      if (it != extended_.end()) index = it->second;
+    } else {
+      index = standard_[cf.can_id & CAN_SFF_MASK];
+    }
+    if (index == kNone) {
+      ++delta.unknownIds;
+      continue;
+    }
+    const RxEntry& e = rx_[index];
+    if (cf.len < e.frameSize) {
+      ++delta.lengthErrors;
+      continue;
+    }
+    IFrame::emitFrameEvent(*e.frame, FrameEvent::PortRx, instanceName_,
+                           std::as_bytes(std::span(cf.data, cf.len)));
+    try {
+      e.frame->deserializeFromWithPublish(
+          std::as_bytes(std::span(cf.data, e.frameSize)));
+      ++delta.delivered;
+    } catch (const std::exception&) {
+      ++delta.lengthErrors;  // 프레임 역직렬화기가 거부
+    }
+  }
+}
+
+/**
+ * @brief 프레임 값을 CAN 프레임으로 직렬화해 송신 (txMutex_ 보유 상태)
+ */
+inline bool SocketCanPort::send(TxEntry& entry) {
+  if (fd_ < 0) return false;
+  canfd_frame cf{};
+  cf.can_id = key(entry.canId, entry.extended);
+  bool ok = true;
+  size_t len = 0;
+  try {
+    const size_t max = fd_enabled_ ? CANFD_MAX_DLEN : CAN_MAX_DLEN;
+    len = entry.frame->serializeInto(
+        std::as_writable_bytes(std::span(cf.data, max)));
+  } catch (const std::exception&) {
+    ok = false;  // 페이로드보다 큰 프레임
+  }
+  if (ok) {
+    // 8바이트 이하는 Classic 프레임으로 송신 (FD 미지원 노드 호환)
+    const size_t mtu = len > CAN_MAX_DLEN ? CANFD_MTU : CAN_MTU;
+    cf.len = static_cast<uint8_t>(mtu == CANFD_MTU ? fdLength(len) : len);
+    ok = ::write(fd_, &cf, mtu) == static_cast<ssize_t>(mtu);
+    if (ok)
+      IFrame::emitFrameEvent(*entry.frame, FrameEvent::PortTx, instanceName_,
+                             std::as_bytes(std::span(cf.data, cf.len)));
+  }
+  Stats delta;
+  (ok ? delta.transmitted : delta.txErrors) = 1;
+  addStats(delta);
+  return ok;
+}
+
+inline bool SocketCanPort::transmit(const std::string& frameName) {
+  std::lock_guard<std::mutex> lock(txMutex_);
+  auto it = tx_.find(frameName);
+  if (it == tx_.end()) return false;
+  return send(it->second);
+}
+
+inline void SocketCanPort::addStats(const Stats& d) {
+  std::lock_guard<std::mutex> lock(statsMutex_);
+  stats_.batches += d.batches;
+  stats_.received += d.received;
+  stats_.delivered += d.delivered;
+  stats_.unknownIds += d.unknownIds;
+  stats_.lengthErrors += d.lengthErrors;
+  stats_.transmitted += d.transmitted;
+  stats_.txErrors += d.txErrors;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_PORT_SOCKETCANPORT_HPP
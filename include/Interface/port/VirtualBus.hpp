@@ -0,0 +1,449 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_PORT_VIRTUALBUS_HPP
+#define NEXUM_COM_EXTERNAL_PORT_VIRTUALBUS_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../executor/SimulationRuntime.hpp"
+
+/**
+ * @brief 프로세스 내 가상 CAN 버스 (중재 / 비트 타이밍 / 버스 부하 모델)
+ *
+ * 여러 노드(VirtualBusPort 등)가 하나의 매체를 공유합니다.
+ * - 버스가 비면 모든 노드의 대기 프레임 중 중재 필드가 가장 작은
+ *   (우선순위가 가장 높은) 프레임이 송신권을 얻고, 나머지는 중재 패배로
+ *   집계된 채 다음 중재를 기다립니다. 유휴 버스에 제출된 프레임도 바로
+ *   송신하지 않고 중재 시점(가상 시간: 같은 시각의 이벤트, 실제 시간:
+ *   1비트 시간 뒤)까지 기다리므로, 같은 순간에 제출된 프레임끼리 경쟁합니다.
+ * - 송신 시간은 비트레이트와 프레임 비트 수(비트 스터핑 최악/없음)로
+ *   계산하며, 송신이 끝나는 시각에 송신 노드를 제외한 모든 노드에
+ *   전달됩니다.
+ * - 버스 점유 시간 / 경과 시간으로 부하율을 구합니다.
+ *
+ * 시간 기준은 SimulationRuntime(가상 시간, 결정적) 또는 실제 시간
+ * (내부 스레드가 송신 시간만큼 대기)을 선택할 수 있습니다.
+ *
+ * @note CAN FD 프레임 길이는 중재/데이터 구간을 나눈 근사치입니다.
+ */
+class VirtualBus {
+ public:
+  using Duration = std::chrono::nanoseconds;
+  using NodeId = uint32_t;
+
+  /** @brief 수신 콜백 (CAN ID, 확장 ID 여부, 페이로드) */
+  using Receiver =
+      std::function<void(uint32_t, bool, std::span<const std::byte>)>;
+
+  /** @brief 비트 스터핑 모델 */
+  enum class Stuffing { None, WorstCase };
+
+  /**
+   * @brief 버스 설정
+   */
+  struct Config {
+    uint32_t bitrate = 500000;      ///< 중재 구간 비트레이트 (bit/s)
+    uint32_t dataBitrate = 0;       ///< FD 데이터 구간 비트레이트 (0: 동일)
+    Stuffing stuffing = Stuffing::WorstCase;  ///< 스터핑 모델
+    size_t nodeQueueCapacity = 64;  ///< 노드별 송신 대기열 크기
+  };
+
+  /**
+   * @brief 버스 통계 (resetStats 이후 누적)
+   */
+  struct Stats {
+    uint64_t frames = 0;             ///< 전송 완료 프레임 수
+    uint64_t arbitrationLosses = 0;  ///< 중재 패배 횟수 (프레임 × 회)
+    uint64_t overflows = 0;          ///< 대기열 포화로 거부된 송신
+    Duration busy{0};                ///< 버스 점유 시간
+    Duration elapsed{0};             ///< 통계 구간 경과 시간
+    Duration maxLatency{0};          ///< 최대 지연 (제출 → 전달)
+    Duration totalLatency{0};        ///< 누적 지연
+
+    /** @brief 부하율 (0~1) */
+    double load() const {
+      return elapsed.count() > 0
+                 ? static_cast<double>(busy.count()) / elapsed.count()
+                 : 0.0;
+    }
+  };
+
+  /** @brief 최대 페이로드 (CAN FD) */
+  static constexpr size_t kMaxPayload = 64;
+
+  /**
+   * @brief 가상 시간 버스 (모든 이벤트가 sim 큐에서 실행됨)
+   */
+  VirtualBus(SimulationRuntime& sim, Config config)
+      : config_(config), sim_(&sim) {
+    validate();
+  }
+
+  /**
+   * @brief 실제 시간 버스 (내부 스레드가 송신 시간을 흘려보냄)
+   */
+  explicit VirtualBus(Config config) : config_(config) {
+    validate();
+    origin_ = std::chrono::steady_clock::now();
+    worker_ = std::thread([this] { realTimeLoop(); });
+  }
+
+  ~VirtualBus() {
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) worker_.join();
+  }
+
+  VirtualBus(const VirtualBus&) = delete;
+  VirtualBus& operator=(const VirtualBus&) = delete;
+
+  /**
+   * @brief 노드 연결
+   * @param receiver 다른 노드가 보낸 프레임 수신 콜백
+   * @return 노드 ID
+   */
+  NodeId attach(Receiver receiver);
+
+  /**
+   * @brief 노드 분리 (대기 중인 송신은 버림)
+   *
+   * 진행 중인 전달이 끝날 때까지 기다리므로, 반환 후에는 receiver가
+   * 더 이상 호출되지 않습니다 (전달 콜백 안에서 호출하면 기다리지 않음).
+   */
+  void detach(NodeId node);
+
+  /**
+   * @brief 프레임 송신 요청
+   * @param node 송신 노드
+   * @param canId CAN ID
+   * @param extended 29비트 확장 ID 여부
+   * @param payload 페이로드 (8바이트 초과면 FD 프레임)
+   * @return 대기열이 가득 찼거나 페이로드가 64바이트를 넘으면 false
+   */
+  bool submit(NodeId node, uint32_t canId, bool extended,
+              std::span<const std::byte> payload);
+
+  /**
+   * @brief 한 프레임의 버스 점유 시간 (IFS 포함)
+   */
+  Duration frameTime(bool extended, size_t length) const;
+
+  /**
+   * @brief 현재 버스 시각 (가상 또는 생성 이후 실제 경과)
+   */
+  Duration now() const {
+    if (sim_) return sim_->now();
+    return std::chrono::duration_cast<Duration>(
+        std::chrono::steady_clock::now() - origin_);
+  }
+
+  /**
+   * @brief 통계 (elapsed는 호출 시각까지)
+   */
+  Stats stats() const;
+
+  /**
+   * @brief 통계 구간 재시작 (예: 워밍업 이후)
+   */
+  void resetStats();
+
+ private:
+  struct Frame {
+    uint64_t key;  ///< 중재 키 (작을수록 우선)
+    uint64_t seq;  ///< 같은 키의 제출 순서
+    NodeId node;
+    uint32_t canId;
+    bool extended;
+    uint8_t length;
+    Duration submitted;
+    std::array<std::byte, kMaxPayload> data;
+  };
+
+  struct Node {
+    Receiver receiver;
+    std::multimap<std::pair<uint64_t, uint64_t>, Frame> queue;  ///< 우선순위
+  };
+
+  /**
+   * @brief 중재 키: 기본 ID 11비트 → IDE(표준 우선) → 확장 18비트
+   */
+  static uint64_t arbitrationKey(uint32_t canId, bool extended) {
+    if (!extended) return static_cast<uint64_t>(canId & 0x7FF) << 19;
+    return (static_cast<uint64_t>((canId >> 18) & 0x7FF) << 19) |
+           (uint64_t{1} << 18) | (canId & 0x3FFFF);
+  }
+
+  void validate() const {
+    if (config_.bitrate == 0)
+      throw std::invalid_argument("VirtualBus: bitrate must be positive");
+  }
+
+  bool arbitrate(Frame& winner);
+  void requestArbitration();
+  void startNext();
+  void complete(const Frame& frame, Duration start, Duration end);
+  void realTimeLoop();
+
+  const Config config_;
+  SimulationRuntime* sim_ = nullptr;
+  std::chrono::steady_clock::time_point origin_;
+
+  mutable std::mutex mtx_;
+  std::condition_variable cv_;
+  std::map<NodeId, Node> nodes_;
+  NodeId nextNode_ = 1;
+  uint64_t nextSeq_ = 0;
+  size_t queued_ = 0;
+  bool transmitting_ = false;
+  bool arbitrationPending_ = false;  ///< (가상 시간) 중재 이벤트 예약됨
+  bool stop_ = false;
+  std::thread::id deliveringThread_;  ///< 전달 중인 스레드 (없으면 기본값)
+  Duration statsStart_{0};
+  Stats stats_;
+  std::thread worker_;
+};
+
+// ------------------- VirtualBus 구현부 -------------------
+
+inline VirtualBus::NodeId VirtualBus::attach(Receiver receiver) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  const NodeId id = nextNode_++;
+  nodes_[id].receiver = std::move(receiver);
+  return id;
+}
+
+inline void VirtualBus::detach(NodeId node) {
+  std::unique_lock<std::mutex> lock(mtx_);
+  auto it = nodes_.find(node);
+  if (it == nodes_.end()) return;
+  queued_ -= it->second.queue.size();
+  nodes_.erase(it);
+  if (deliveringThread_ == std::this_thread::get_id()) return;
+  cv_.wait(lock, [this] { return deliveringThread_ == std::thread::id(); });
+}
+
+inline bool VirtualBus::submit(NodeId node, uint32_t canId, bool extended,
+                               std::span<const std::byte> payload) {
+  if (payload.size() > kMaxPayload) return false;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto it = nodes_.find(node);
+    if (it == nodes_.end()) return false;
+    if (it->second.queue.size() >= config_.nodeQueueCapacity) {
+      ++stats_.overflows;
+      return false;
+    }
+    Frame f{arbitrationKey(canId, extended), nextSeq_++, node, canId,
+            extended, static_cast<uint8_t>(payload.size()), now(), {}};
+    std::memcpy(f.data.data(), payload.data(), payload.size());
+    it->second.queue.emplace(std::make_pair(f.key, f.seq), f);
+    ++queued_;
+  }
+  if (sim_) {
+    requestArbitration();
+  } else {
+    cv_.notify_all();
+  }
+  return true;
+}
+
+inline VirtualBus::Duration VirtualBus::frameTime(bool extended,
+                                                  size_t length) const {
+  const bool stuff = config_.stuffing == Stuffing::WorstCase;
+  const double nominal = 1e9 / config_.bitrate;
+  if (length <= 8) {
+    // Classic: 스터핑 대상 g + 8n 비트, 비대상 13비트 (CRC 구분자~IFS)
+    const size_t g = extended ? 54 : 34;
+    const size_t stuffed = g + 8 * length;
+    const size_t bits =
+        stuffed + 13 + (stuff ? (stuffed - 1) / 4 : 0);
+    return Duration(static_cast<int64_t>(bits * nominal));
+  }
+  // FD (근사): 중재 구간 + 꼬리는 nominal, 데이터 구간은 data 비트레이트
+  const double data = 1e9 / (config_.dataBitrate ? config_.dataBitrate
+                                                 : config_.bitrate);
+  const size_t arb = extended ? 36 : 17;
+  const size_t tail = 13;
+  const size_t payload = 8 * length + (length <= 16 ? 17 : 21) + 9;
+  const double arbBits = arb + (stuff ? arb / 4.0 : 0) + tail;
+  const double dataBits = payload + (stuff ? payload / 4.0 : 0);
+  return Duration(static_cast<int64_t>(arbBits * nominal + dataBits * data));
+}
+
+/**
+ * @brief 최우선 프레임을 꺼내고 나머지 대기 프레임을 중재 패배로 집계
+ * @return 대기 프레임이 없으면 false (mtx_ 보유 상태)
+ */
+inline bool VirtualBus::arbitrate(Frame& winner) {
+  Node* best = nullptr;
+  for (auto& [id, node] : nodes_) {
+    if (node.queue.empty()) continue;
+    if (!best || node.queue.begin()->first < best->queue.begin()->first)
+      best = &node;
+  }
+  if (!best) return false;
+  // 각 노드는 자기 최우선 프레임 1개로 중재에 참여
+  for (auto& [id, node] : nodes_)
+    if (&node != best && !node.queue.empty()) ++stats_.arbitrationLosses;
+  auto it = best->queue.begin();
+  winner = it->second;
+  best->queue.erase(it);
+  --queued_;
+  return true;
+}
+
+/**
+ * @brief (가상 시간) 버스가 비어 있으면 현재 시각에 중재 이벤트 예약
+ *
+ * 같은 시각에 이미 예약된 이벤트가 먼저 실행되므로, 그 안에서 제출된
+ * 프레임도 이번 중재에 참여합니다.
+ */
+inline void VirtualBus::requestArbitration() {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (transmitting_ || arbitrationPending_ || queued_ == 0) return;
+    arbitrationPending_ = true;
+  }
+  sim_->scheduleAt(sim_->now(), [this] { startNext(); });
+}
+
+/**
+ * @brief (가상 시간) 중재 후 다음 프레임 송신 시작
+ */
+inline void VirtualBus::startNext() {
+  Frame f;
+  Duration start, end;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    arbitrationPending_ = false;
+    if (transmitting_ || !arbitrate(f)) return;
+    transmitting_ = true;
+    start = sim_->now();
+    end = start + frameTime(f.extended, f.length);
+  }
+  sim_->scheduleAt(end, [this, f, start, end] {
+    complete(f, start, end);
+    requestArbitration();
+  });
+}
+
+/**
+ * @brief 송신 완료: 통계 갱신 후 송신 노드 외 모든 노드에 전달
+ */
+inline void VirtualBus::complete(const Frame& f, Duration start,
+                                 Duration end) {
+  std::vector<Receiver> receivers;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    transmitting_ = false;
+    ++stats_.frames;
+    stats_.busy += end - std::max(start, statsStart_);
+    const Duration latency = end - f.submitted;
+    stats_.maxLatency = std::max(stats_.maxLatency, latency);
+    stats_.totalLatency += latency;
+    receivers.reserve(nodes_.size());
+    for (auto& [id, node] : nodes_)
+      if (id != f.node && node.receiver) receivers.push_back(node.receiver);
+    deliveringThread_ = std::this_thread::get_id();
+  }
+  struct Done {
+    VirtualBus* bus;
+    ~Done() {
+      {
+        std::lock_guard<std::mutex> lock(bus->mtx_);
+        bus->deliveringThread_ = std::thread::id();
+      }
+      bus->cv_.notify_all();
+    }
+  } done{this};  // 수신 콜백 예외 시에도 detach 대기 해제
+  const std::span<const std::byte> payload(f.data.data(), f.length);
+  for (auto& r : receivers) r(f.canId, f.extended, payload);
+}
+
+inline void VirtualBus::realTimeLoop() {
+  std::unique_lock<std::mutex> lock(mtx_);
+  const Duration bitTime(1000000000 / config_.bitrate);
+  while (true) {
+    if (!stop_ && queued_ == 0) {
+      cv_.wait(lock, [this] { return stop_ || queued_ > 0; });
+      // 유휴 버스: 1비트 시간 안에 제출된 프레임도 중재에 참여
+      cv_.wait_for(lock, bitTime, [this] { return stop_; });
+    }
+    if (stop_) return;
+    Frame f;
+    if (!arbitrate(f)) continue;
+    transmitting_ = true;
+    const Duration start = now();
+    const Duration end = start + frameTime(f.extended, f.length);
+    lock.unlock();
+    std::this_thread::sleep_until(origin_ + end);
+    complete(f, start, end);
+    lock.lock();
+  }
+}
+
+inline VirtualBus::Stats VirtualBus::stats() const {
+  const Duration t = now();
+  std::lock_guard<std::mutex> lock(mtx_);
+  Stats s = stats_;
+  s.elapsed = t - statsStart_;
+  return s;
+}
+
+inline void VirtualBus::resetStats() {
+  const Duration t = now();
+  std::lock_guard<std::mutex> lock(mtx_);
+  stats_ = Stats{};
+  statsStart_ = t;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_PORT_VIRTUALBUS_HPP
@@ -0,0 +1,252 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_PORT_VIRTUALBUSPORT_HPP
+#define NEXUM_COM_EXTERNAL_PORT_VIRTUALBUSPORT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+#include "PortBase.hpp"
+#include "VirtualBus.hpp"
+
+/**
+ * @brief VirtualBus에 연결되는 포트 (SocketCanPort와 같은 매핑 방식)
+ *
+ * bindTx로 매핑한 프레임은 publish될 때(또는 transmit 호출 시) 버스에
+ * 제출되고, 중재와 송신 시간을 거쳐 다른 포트들에 전달됩니다.
+ * bindRx로 매핑한 ID를 받으면 해당 프레임에 역직렬화 후 publish합니다.
+ *
+ * 사용: VirtualBusPort p("ecu1"); p.configure(bus); p.bindRx(...);
+ *       p.bindTx(...); p.open();
+ */
+class VirtualBusPort : public PortBase<VirtualBusPort> {
+ public:
+  /**
+   * @brief 포트 통계
+   */
+  struct Stats {
+    uint64_t submitted = 0;     ///< 버스에 제출한 프레임 수
+    uint64_t rejected = 0;      ///< 대기열 포화 등으로 거부된 제출
+    uint64_t delivered = 0;     ///< 프레임에 반영한 수신
+    uint64_t unknownIds = 0;    ///< 매핑 없는 ID 수신
+    uint64_t lengthErrors = 0;  ///< 페이로드가 프레임보다 짧음
+  };
+
+  explicit VirtualBusPort(const std::string& instanceName)
+      : PortBase(instanceName) {}
+  ~VirtualBusPort() override { close(); }
+
+  static std::string staticName() { return "VirtualBusPort"; }
+  std::string type() const override { return "virtualbus"; }
+
+  /**
+   * @brief 연결할 버스 설정 (open 이전, 버스가 포트보다 오래 살아야 함)
+   */
+  void configure(VirtualBus& bus) { bus_ = &bus; }
+
+  /**
+   * @brief 수신 매핑 등록 (open 이전)
+   * @return 프레임이 없으면 false
+   */
+  bool bindRx(const std::string& frameName, uint32_t canId,
+              bool extended = false);
+
+  /**
+   * @brief 송신 매핑 등록 (open 이전)
+   * @param sendOnPublish 프레임이 publish될 때마다 자동 제출
+   * @return 프레임이 없으면 false
+   */
+  bool bindTx(const std::string& frameName, uint32_t canId,
+              bool extended = false, bool sendOnPublish = true);
+
+  /**
+   * @brief 버스에 노드로 연결하고 송신 구독 시작
+   * @return 버스 미설정 시 false
+   */
+  bool open() override;
+
+  /**
+   * @brief 구독 해제 및 버스에서 분리
+   */
+  void close() override;
+
+  /**
+   * @brief 송신 매핑된 프레임의 현재 값을 버스에 제출
+   * @return 매핑 없음/미개방/거부 시 false
+   */
+  bool transmit(const std::string& frameName);
+
+  /**
+   * @brief 포트 통계
+   */
+  Stats stats() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return stats_;
+  }
+
+ private:
+  struct RxEntry {
+    std::shared_ptr<IFrame> frame;
+    size_t frameSize;
+  };
+
+  struct TxEntry {
+    uint32_t canId;
+    bool extended;
+    bool sendOnPublish;
+    std::shared_ptr<IFrame> frame;
+    IFrame::CallbackId callbackId = 0;
+  };
+
+  static uint64_t key(uint32_t canId, bool extended) {
+    return (static_cast<uint64_t>(extended) << 32) | canId;
+  }
+
+  void receive(uint32_t canId, bool extended,
+               std::span<const std::byte> payload);
+  bool send(const TxEntry& entry);
+
+  VirtualBus* bus_ = nullptr;
+  VirtualBus::NodeId node_ = 0;
+  std::unordered_map<uint64_t, RxEntry> rx_;
+  std::unordered_map<std::string, TxEntry> tx_;
+
+  mutable std::mutex statsMutex_;
+  Stats stats_;
+};
+
+// ------------------- VirtualBusPort 구현부 -------------------
+
+inline bool VirtualBusPort::bindRx(const std::string& frameName,
+                                   uint32_t canId, bool extended) {
+  if (node_ || !connectFrame(frameName)) return false;
+  auto frame = findFrame(frameName);
+  if (!frame) return false;
+  rx_[key(canId, extended)] = RxEntry{frame, frame->serializedSize()};
+  return true;
+}
+
+inline bool VirtualBusPort::bindTx(const std::string& frameName,
+                                   uint32_t canId, bool extended,
+                                   bool sendOnPublish) {
+  if (node_ || !connectFrame(frameName)) return false;
+  auto frame = findFrame(frameName);
+  if (!frame) return false;
+  tx_[frameName] = TxEntry{canId, extended, sendOnPublish, frame};
+  return true;
+}
+
+inline bool VirtualBusPort::open() {
+  if (node_) return true;
+  if (!bus_) return false;
+  node_ = bus_->attach(
+      [this](uint32_t id, bool ext, std::span<const std::byte> payload) {
+        receive(id, ext, payload);
+      });
+  for (auto& [name, entry] : tx_) {
+    if (!entry.sendOnPublish) continue;
+    const TxEntry* e = &entry;  // unordered_map 노드 주소는 안정적
+    entry.callbackId = entry.frame->addCallback(
+        [this, e](const IFrame&) { send(*e); }, CallbackPolicy::Direct);
+  }
+  return true;
+}
+
+inline void VirtualBusPort::close() {
+  for (auto& [name, entry] : tx_) {
+    if (entry.callbackId) entry.frame->removeCallback(entry.callbackId);
+    entry.callbackId = 0;
+  }
+  if (node_) bus_->detach(node_);
+  node_ = 0;
+}
+
+inline bool VirtualBusPort::transmit(const std::string& frameName) {
+  auto it = tx_.find(frameName);
+  if (it == tx_.end() || !node_) return false;
+  return send(it->second);
+}
+
+inline bool VirtualBusPort::send(const TxEntry& e) {
+  std::array<std::byte, VirtualBus::kMaxPayload> buf;
+  bool ok = true;
+  size_t len = 0;
+  try {
+    len = e.frame->serializeInto(buf);
+  } catch (const std::exception&) {
+    ok = false;  // 64바이트를 넘는 프레임
+  }
+  const std::span<const std::byte> payload(buf.data(), len);
+  ok = ok && bus_->submit(node_, e.canId, e.extended, payload);
+  if (ok)
+    IFrame::emitFrameEvent(*e.frame, FrameEvent::PortTx, instanceName_,
+                           payload);
+  std::lock_guard<std::mutex> lock(statsMutex_);
+  ++(ok ? stats_.submitted : stats_.rejected);
+  return ok;
+}
+
+inline void VirtualBusPort::receive(uint32_t canId, bool extended,
+                                    std::span<const std::byte> payload) {
+  auto it = rx_.find(key(canId, extended));
+  bool delivered = false, unknown = it == rx_.end(), shortLen = false;
+  if (!unknown) {
+    const RxEntry& e = it->second;
+    IFrame::emitFrameEvent(*e.frame, FrameEvent::PortRx, instanceName_,
+                           payload);
+    shortLen = payload.size() < e.frameSize;
+    if (!shortLen) {
+      try {
+        e.frame->deserializeFromWithPublish(payload.first(e.frameSize));
+        delivered = true;
+      } catch (const std::exception&) {
+        shortLen = true;  // 프레임 역직렬화기가 거부
+      }
+    }
+  }
+  std::lock_guard<std::mutex> lock(statsMutex_);
+  stats_.delivered += delivered;
+  stats_.unknownIds += unknown;
+  stats_.lengthErrors += shortLen;
+}
+
+#endif  // NEXUM_COM_EXTERNAL_PORT_VIRTUALBUSPORT_HPP
@@ -0,0 +1,306 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_BENCHMARK_BENCHHARNESS_HPP
+#define NEXUM_COM_EXTERNAL_BENCHMARK_BENCHHARNESS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "PerfCounters.hpp"
+
+/**
+ * @brief 벤치마크 1건의 결과 (반복 실행별 ns/op)
+ */
+struct BenchResult {
+  std::string name;             ///< 벤치마크 이름
+  uint64_t opsPerRep = 0;       ///< 반복 1회당 연산 수
+  std::vector<double> nsPerOp;  ///< 반복별 연산당 시간 (ns)
+  /** @brief 부가 지표 (이름, 값) */
+  std::vector<std::pair<std::string, double>> metrics;
+
+  /** @brief 반복별 결과의 중앙값 */
+  double median() const {
+    if (nsPerOp.empty()) return 0.0;
+    std::vector<double> v = nsPerOp;
+    std::sort(v.begin(), v.end());
+    const size_t n = v.size();
+    return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2.0;
+  }
+};
+
+/**
+ * @brief threads개 스레드가 동시에 fn(thread, i)를 opsPerThread회 수행
+ *
+ * 모든 스레드가 생성된 뒤 동시에 출발합니다.
+ * @return 전체 연산 수
+ */
+template <typename Fn>
+inline uint64_t runThreads(size_t threads, uint64_t opsPerThread, Fn fn) {
+  std::atomic<bool> go{false};
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+      for (uint64_t i = 0; i < opsPerThread; ++i) fn(t, i);
+    });
+  }
+  go.store(true, std::memory_order_release);
+  for (auto& w : workers) w.join();
+  return threads * opsPerThread;
+}
+
+/**
+ * @brief 라이브러리 핫패스 벤치마크용 최소 하니스
+ *
+ * 각 벤치마크 본문을 warmup 후 reps회 반복 실행하고, 반복별 ns/op를
+ * 표로 출력하며 --json 지정 시 JSON 결과 파일을 기록합니다.
+ * (bench_compare 도구 입력 형식)
+ *
+ * 명령행 옵션:
+ * - --reps=N      반복 횟수 (기본 5)
+ * - --warmup=N    측정 제외 반복 횟수 (기본 1)
+ * - --filter=STR  이름에 STR이 포함된 벤치마크만 실행
+ * - --json=PATH   JSON 결과 파일 경로
+ * - --perf        perf_event_open 카운터를 연산당 지표로 기록
+ *                 (사용할 수 없으면 경고 후 시간만 측정)
+ */
+class BenchHarness {
+ public:
+  /**
+   * @brief 반복 1회 본문. 수행한 연산 수를 반환합니다.
+   */
+  using Body = std::function<uint64_t()>;
+
+  BenchHarness(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+      const std::string arg = argv[i];
+      if (arg.rfind("--reps=", 0) == 0) {
+        reps_ = std::max(1, std::stoi(arg.substr(7)));
+      } else if (arg.rfind("--warmup=", 0) == 0) {
+        warmup_ = std::max(0, std::stoi(arg.substr(9)));
+      } else if (arg.rfind("--filter=", 0) == 0) {
+        filter_ = arg.substr(9);
+      } else if (arg.rfind("--json=", 0) == 0) {
+        jsonPath_ = arg.substr(7);
+      } else if (arg == "--perf") {
+        perf_ = std::make_unique<PerfCounters>();
+        if (!perf_->available()) {
+          std::cerr << "BenchHarness: perf counters unavailable ("
+                    << perf_->unavailableReason()
+                    << "), reporting wall-clock only\n";
+          perf_.reset();
+        } else if (!perf_->unavailableReason().empty()) {
+          std::cerr << "BenchHarness: some perf counters unavailable ("
+                    << perf_->unavailableReason() << ")\n";
+        }
+      } else {
+        extraArgs_.push_back(arg);
+      }
+    }
+  }
+
+  /**
+   * @brief 하니스가 해석하지 않은 명령행 인자 (벤치마크별 옵션용)
+   */
+  const std::vector<std::string>& extraArgs() const { return extraArgs_; }
+
+  /**
+   * @brief 필터 조건에 맞는지 확인 (비싼 준비 작업 생략용)
+   */
+  bool enabled(const std::string& name) const {
+    return filter_.empty() || name.find(filter_) != std::string::npos;
+  }
+
+  /**
+   * @brief 벤치마크 실행 및 결과 기록
+   * @param name 벤치마크 이름
+   * @param body 반복 1회 본문
+   * @return 기록된 결과 (필터로 제외 시 nullptr, 다음 run 호출 전까지 유효)
+   */
+  BenchResult* run(const std::string& name, const Body& body) {
+    if (!enabled(name)) return nullptr;
+    for (int i = 0; i < warmup_; ++i) body();
+    BenchResult r;
+    r.name = name;
+    PerfCounters::Sample total;
+    uint64_t totalOps = 0;
+    for (int i = 0; i < reps_; ++i) {
+      if (perf_) perf_->start();
+      const auto t0 = std::chrono::steady_clock::now();
+      const uint64_t ops = body();
+      const auto t1 = std::chrono::steady_clock::now();
+      if (perf_) {
+        const PerfCounters::Sample s = perf_->stop();
+        for (size_t c = 0; c < PerfCounters::kCount; ++c) {
+          total.value[c] += s.value[c];
+          total.valid[c] = (i == 0 || total.valid[c]) && s.valid[c];
+        }
+        totalOps += ops;
+      }
+      const double ns = std::chrono::duration<double, std::nano>(t1 - t0)
+                            .count();
+      r.opsPerRep = ops;
+      r.nsPerOp.push_back(ops ? ns / static_cast<double>(ops) : ns);
+    }
+    const std::string perfLine =
+        perf_ ? addPerfMetrics(r, total, totalOps) : std::string();
+    results_.push_back(std::move(r));
+    printRow(results_.back());
+    if (!perfLine.empty()) std::printf("%s\n", perfLine.c_str());
+    return &results_.back();
+  }
+
+  /**
+   * @brief 기록된 결과 목록
+   */
+  const std::vector<BenchResult>& results() const { return results_; }
+
+  /**
+   * @brief JSON 결과 파일 기록 후 종료 코드 반환
+   * @return 0: 성공, 1: JSON 기록 실패
+   */
+  int finish() const {
+    if (jsonPath_.empty()) return 0;
+    std::ofstream out(jsonPath_);
+    if (!out) {
+      std::cerr << "BenchHarness: cannot write " << jsonPath_ << "\n";
+      return 1;
+    }
+    writeJson(out);
+    return out.good() ? 0 : 1;
+  }
+
+  /**
+   * @brief JSON 결과 직렬화
+   *
+   * {"format":"nexum-bench","version":1,"benchmarks":[{"name":..,
+   *  "ops_per_rep":..,"ns_per_op":[..],"metrics":{..}}]}
+   */
+  void writeJson(std::ostream& out) const {
+    out << "{\"format\":\"nexum-bench\",\"version\":1,\"benchmarks\":[";
+    for (size_t i = 0; i < results_.size(); ++i) {
+      const BenchResult& r = results_[i];
+      out << (i ? ",\n" : "\n") << "{\"name\":\"" << escape(r.name)
+          << "\",\"ops_per_rep\":" << r.opsPerRep << ",\"ns_per_op\":[";
+      for (size_t j = 0; j < r.nsPerOp.size(); ++j)
+        out << (j ? "," : "") << number(r.nsPerOp[j]);
+      out << "],\"metrics\":{";
+      for (size_t j = 0; j < r.metrics.size(); ++j)
+        out << (j ? "," : "") << "\"" << escape(r.metrics[j].first)
+            << "\":" << number(r.metrics[j].second);
+      out << "}}";
+    }
+    out << "\n]}\n";
+  }
+
+ private:
+  /**
+   * @brief 카운터 합계를 연산당 지표로 변환해 기록
+   * @return 출력용 요약 줄
+   */
+  static std::string addPerfMetrics(BenchResult& r,
+                                    const PerfCounters::Sample& s,
+                                    uint64_t ops) {
+    if (ops == 0) return {};
+    std::string line = "    perf/op:";
+    for (size_t c = 0; c < PerfCounters::kCount; ++c) {
+      if (!s.valid[c]) continue;
+      const auto counter = static_cast<PerfCounters::Counter>(c);
+      const double perOp = s.value[c] / static_cast<double>(ops);
+      r.metrics.emplace_back(std::string(PerfCounters::name(counter)) +
+                                 "_per_op",
+                             perOp);
+      line += " " + std::string(PerfCounters::name(counter)) + "=" +
+              number(perOp);
+    }
+    if (s.valid[PerfCounters::Cycles] && s.valid[PerfCounters::Instructions] &&
+        s.value[PerfCounters::Cycles] > 0) {
+      const double ipc = s.value[PerfCounters::Instructions] /
+                         s.value[PerfCounters::Cycles];
+      r.metrics.emplace_back("ipc", ipc);
+      line += " ipc=" + number(ipc);
+    }
+    return line;
+  }
+
+  static std::string escape(const std::string& s) {
+    std::string o;
+    for (char c : s) {
+      if (c == '"' || c == '\\') o.push_back('\\');
+      o.push_back(c);
+    }
+    return o;
+  }
+
+  static std::string number(double v) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.6g", v);
+    return buf;
+  }
+
+  static void printRow(const BenchResult& r) {
+    double lo = r.nsPerOp.front(), hi = r.nsPerOp.front();
+    for (double v : r.nsPerOp) {
+      lo = std::min(lo, v);
+      hi = std::max(hi, v);
+    }
+    const double med = r.median();
+    std::printf("%-56s %12.2f ns/op  [%.2f .. %.2f]  %10.3f Mops/s\n",
+                r.name.c_str(), med, lo, hi, med > 0 ? 1e3 / med : 0.0);
+  }
+
+  int reps_ = 5;
+  int warmup_ = 1;
+  std::string filter_;
+  std::string jsonPath_;
+  std::vector<std::string> extraArgs_;
+  std::vector<BenchResult> results_;
+  std::unique_ptr<PerfCounters> perf_;  ///< --perf 지정 + 사용 가능 시
+};
+
+#endif  // NEXUM_COM_EXTERNAL_BENCHMARK_BENCHHARNESS_HPP
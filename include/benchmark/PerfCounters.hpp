@@ -0,0 +1,203 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NEXUM_COM_EXTERNAL_BENCHMARK_PERFCOUNTERS_HPP
+#define NEXUM_COM_EXTERNAL_BENCHMARK_PERFCOUNTERS_HPP
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief perf_event_open 기반 하드웨어/소프트웨어 카운터 묶음
+ *
+ * cycles, instructions, cache-misses, branch-misses, context-switches를
+ * 호출 스레드와 이후 생성되는 자식 스레드(inherit)에 대해 측정합니다.
+ * 카운터마다 따로 열기 때문에 컨테이너 등에서 일부만 열리면 열린
+ * 카운터만 보고하고, 다중화된 경우 enabled/running 비율로 보정합니다.
+ * Linux가 아니거나 모두 실패하면 available()이 false입니다.
+ */
+class PerfCounters {
+ public:
+  enum Counter : size_t {
+    Cycles,
+    Instructions,
+    CacheMisses,
+    BranchMisses,
+    ContextSwitches,
+    kCount
+  };
+
+  /**
+   * @brief 카운터 값 (열리지 않은 카운터는 valid=false)
+   */
+  struct Sample {
+    std::array<double, kCount> value{};
+    std::array<bool, kCount> valid{};
+  };
+
+  PerfCounters() {
+    fds_.fill(-1);
+#ifdef __linux__
+    for (size_t i = 0; i < kCount; ++i) fds_[i] = open(static_cast<Counter>(i));
+#endif
+    for (int fd : fds_)
+      if (fd >= 0) available_ = true;
+    if (!available_ && reason_.empty()) reason_ = "not supported";
+  }
+
+  ~PerfCounters() {
+#ifdef __linux__
+    for (int fd : fds_)
+      if (fd >= 0) ::close(fd);
+#endif
+  }
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  /**
+   * @brief 하나 이상의 카운터가 열렸는지
+   */
+  bool available() const { return available_; }
+
+  /**
+   * @brief 첫 번째 열기 실패 사유 (예: perf_event_paranoid, seccomp)
+   */
+  const std::string& unavailableReason() const { return reason_; }
+
+  /**
+   * @brief 카운터 이름 (지표 이름 접두사)
+   */
+  static const char* name(Counter c) {
+    static const char* names[kCount] = {"cycles", "instructions",
+                                        "cache_misses", "branch_misses",
+                                        "context_switches"};
+    return names[c];
+  }
+
+  /**
+   * @brief 0으로 초기화 후 측정 시작
+   */
+  void start() {
+#ifdef __linux__
+    for (int fd : fds_) {
+      if (fd < 0) continue;
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  /**
+   * @brief 측정 중지 후 값 읽기 (다중화 보정 적용)
+   */
+  Sample stop() {
+    Sample s;
+#ifdef __linux__
+    for (int fd : fds_)
+      if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    for (size_t i = 0; i < kCount; ++i) {
+      if (fds_[i] < 0) continue;
+      uint64_t buf[3] = {0, 0, 0};  // value, time_enabled, time_running
+      if (::read(fds_[i], buf, sizeof(buf)) != sizeof(buf)) continue;
+      if (buf[2] == 0) continue;  // 한 번도 스케줄되지 않음
+      s.value[i] = double(buf[0]) * double(buf[1]) / double(buf[2]);
+      s.valid[i] = true;
+    }
+#endif
+    return s;
+  }
+
+ private:
+#ifdef __linux__
+  int open(Counter c) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = 1;
+    attr.inherit = 1;  // 벤치마크 본문이 만드는 스레드 포함
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    switch (c) {
+      case Cycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case Instructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case CacheMisses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+      case BranchMisses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      default:
+        attr.type = PERF_TYPE_SOFTWARE;
+        attr.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+        break;
+    }
+    // 커널 포함으로 먼저 시도하고, 권한 부족이면 사용자 공간만 측정
+    for (int excludeKernel = 0; excludeKernel <= 1; ++excludeKernel) {
+      attr.exclude_kernel = excludeKernel;
+      const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+      if (fd >= 0) return static_cast<int>(fd);
+      if (reason_.empty() && excludeKernel)
+        reason_ = std::string(name(c)) + ": " + std::strerror(errno);
+    }
+    return -1;
+  }
+#endif
+
+  std::array<int, kCount> fds_;
+  bool available_ = false;
+  std::string reason_;
+};
+
+#endif  // NEXUM_COM_EXTERNAL_BENCHMARK_PERFCOUNTERS_HPP
@@ -0,0 +1,167 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// AtomicFrameBase 핫패스 벤치마크: 원자 슬롯 load/store/update 와
+// FrameBase(shared_mutex) 기준선을 스레드 수별로 비교합니다.
+// 읽기 전용 항목은 리더 확장성(캐시 라인 경합 여부)을 보여 줍니다.
+//
+// 빌드 예:
+//   g++ -std=c++20 -O2 -pthread -I<include 상위> atomic_frame.cpp -latomic
+// 실행 예:
+//   ./a.out --reps=5 --json=atomic_frame.json [--max-threads=8]
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "com/external/Interface/interface.h"
+#include "com/external/benchmark/BenchHarness.hpp"
+
+// --- 벤치마크용 최소 프레임 ---
+struct BenchWord8 {
+  uint32_t lo;
+  uint32_t hi;
+};
+
+struct BenchWord16 {
+  uint64_t lo;
+  uint64_t hi;
+};
+
+class Atomic8Frame : public AtomicFrameBase<BenchWord8, Atomic8Frame> {
+ public:
+  static std::string staticName() { return "BenchAtomic8Frame"; }
+  explicit Atomic8Frame(const std::string& instanceName)
+      : AtomicFrameBase(instanceName) {
+    registerSignal("lo", &BenchWord8::lo);
+  }
+};
+
+class Atomic16Frame : public AtomicFrameBase<BenchWord16, Atomic16Frame> {
+ public:
+  static std::string staticName() { return "BenchAtomic16Frame"; }
+  explicit Atomic16Frame(const std::string& instanceName)
+      : AtomicFrameBase(instanceName) {
+    registerSignal("lo", &BenchWord16::lo);
+  }
+};
+
+class Locked16Frame : public FrameBase<BenchWord16, Locked16Frame> {
+ public:
+  static std::string staticName() { return "BenchLocked16Frame"; }
+  explicit Locked16Frame(const std::string& instanceName)
+      : FrameBase(instanceName) {
+    registerSignal("lo", &BenchWord16::lo, &data_, &data_rwlock_);
+  }
+};
+
+// 스레드별 누적값 (최적화로 읽기가 사라지지 않게, 캐시 라인 분리)
+struct alignas(64) Sink {
+  uint64_t value = 0;
+};
+
+int main(int argc, char** argv) {
+  BenchHarness harness(argc, argv);
+  size_t maxThreads = 8;
+  uint64_t opsPerThread = 1000000;
+  for (const auto& arg : harness.extraArgs()) {
+    if (arg.rfind("--max-threads=", 0) == 0)
+      maxThreads = std::stoul(arg.substr(14));
+    if (arg.rfind("--ops=", 0) == 0) opsPerThread = std::stoull(arg.substr(6));
+  }
+
+  Atomic8Frame a8("bench.atomic8");
+  Atomic16Frame a16("bench.atomic16");
+  Locked16Frame l16("bench.locked16");
+  std::vector<Sink> sinks(maxThreads);
+
+  for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+    const std::string suffix = "/threads:" + std::to_string(threads);
+
+    // 읽기 전용 (리더 확장성)
+    harness.run("atomic8/load" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t) {
+        sinks[t].value += a8.load().lo;
+      });
+    });
+    harness.run("atomic16/load" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t) {
+        sinks[t].value += a16.load().lo;
+      });
+    });
+    harness.run("locked16/read" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t) {
+        l16.readRawData([&](const char* p, size_t) {
+          uint64_t v;
+          std::memcpy(&v, p, sizeof(v));
+          sinks[t].value += v;
+        });
+      });
+    });
+
+    // 쓰기 전용
+    harness.run("atomic8/store" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t i) {
+        a8.store(BenchWord8{static_cast<uint32_t>(i),
+                            static_cast<uint32_t>(t)});
+      });
+    });
+    harness.run("atomic16/store" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t i) {
+        a16.store(BenchWord16{i, t});
+      });
+    });
+    harness.run("atomic8/update" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t, uint64_t) {
+        a8.update([](BenchWord8& d) { ++d.lo; });
+      });
+    });
+    harness.run("locked16/write" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t i) {
+        l16.writeRawData([&](char* p, size_t) {
+          const BenchWord16 w{i, t};
+          std::memcpy(p, &w, sizeof(w));
+        });
+      });
+    });
+  }
+
+  uint64_t total = 0;
+  for (const auto& s : sinks) total += s.value;
+  std::printf("checksum %llu\n", static_cast<unsigned long long>(total));
+  return harness.finish();
+}
@@ -0,0 +1,130 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Atomic 신호 스트레스: 락 없는 Atomic setter와 전체 프레임 쓰기
+// (deserialize / writeRawData) 를 같은 프레임에 섞어 실행합니다.
+// ThreadSanitizer 빌드에서 경합 보고가 없어야 하며, 읽기 쪽은 전체 쓰기가
+// 찢어진 상태(a != b)를 보면 실패로 종료합니다.
+//
+// 빌드 예:
+//   g++ -std=c++20 -O1 -g -fsanitize=thread -pthread -I<include 상위>
+//       atomic_signal_stress.cpp
+// 실행 예:
+//   ./a.out [--ops=200000]
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "com/external/Interface/interface.h"
+
+struct StressData {
+  uint32_t counter;  ///< Atomic 신호 (락 없이 갱신)
+  uint32_t flags;    ///< Atomic 신호 (락 없이 갱신)
+  uint64_t a;        ///< 전체 쓰기에서 b와 같은 값
+  uint64_t b;
+};
+
+class StressFrame : public FrameBase<StressData, StressFrame> {
+ public:
+  static std::string staticName() { return "StressFrame"; }
+  explicit StressFrame(const std::string& instanceName)
+      : FrameBase(instanceName) {
+    registerSignal("counter", &StressData::counter, &data_, &data_rwlock_,
+                   SignalAccess::Atomic);
+    registerSignal("flags", &StressData::flags, &data_, &data_rwlock_,
+                   SignalAccess::Atomic);
+  }
+};
+
+int main(int argc, char** argv) {
+  uint64_t ops = 200000;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg.rfind("--ops=", 0) == 0) ops = std::stoull(arg.substr(6));
+  }
+
+  StressFrame frame("stress");
+  std::atomic<bool> stop{false};
+  std::atomic<uint64_t> torn{0};
+
+  std::vector<std::thread> threads;
+  // Atomic setter 2개 (락 없음)
+  for (int t = 0; t < 2; ++t) {
+    threads.emplace_back([&, t] {
+      const char* name = t == 0 ? "counter" : "flags";
+      for (uint32_t i = 0; !stop.load(std::memory_order_relaxed); ++i)
+        frame.setSignal(name, i);
+    });
+  }
+  // 읽기: 전체 쓰기 값 a/b 가 항상 짝이 맞아야 함
+  threads.emplace_back([&] {
+    while (!stop.load(std::memory_order_relaxed)) {
+      frame.readRawData([&](const char* p, size_t) {
+        StressData d;
+        std::memcpy(&d, p, sizeof(d));
+        if (d.a != d.b) torn.fetch_add(1, std::memory_order_relaxed);
+      });
+      (void)frame.getSignal("counter");
+    }
+  });
+
+  // 전체 쓰기: deserialize와 writeRawData를 번갈아 사용
+  std::vector<uint8_t> raw(sizeof(StressData));
+  for (uint64_t i = 1; i <= ops; ++i) {
+    if (i % 2) {
+      StressData d{};
+      d.a = d.b = i;
+      std::memcpy(raw.data(), &d, sizeof(d));
+      frame.deserialize(raw);
+    } else {
+      frame.writeRawData([i](char* p, size_t) {
+        auto* d = reinterpret_cast<StressData*>(p);
+        d->a = d->b = i;
+      });
+    }
+  }
+  stop.store(true);
+  for (auto& t : threads) t.join();
+
+  std::printf("atomic_signal_stress: ops=%llu torn=%llu\n",
+              static_cast<unsigned long long>(ops),
+              static_cast<unsigned long long>(torn.load()));
+  return torn.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// BusCheckpoint 벤치마크: 버스 전체 저장(save) / mmap 복원(restore)
+//
+// 측정 전에 왕복 검증을 먼저 수행합니다. data()로 직접 수정해 버전이
+// 0인 프레임도 저장 -> 0으로 덮어쓰기 -> 복원 후 값이 돌아와야 하며,
+// 그렇지 않으면 실패로 종료합니다.
+//
+// 빌드 예:
+//   g++ -std=c++20 -O2 -pthread -I<include 상위> checkpoint.cpp
+// 실행 예:
+//   ./a.out --reps=5 [--frames=10000] [--path=/tmp/nexum.ckpt]
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "com/external/Interface/bus_Factory/BusCheckpoint.hpp"
+#include "com/external/Interface/interface.h"
+#include "com/external/benchmark/BenchHarness.hpp"
+
+// --- 벤치마크용 최소 프레임 ---
+struct BenchRecord {
+  uint64_t id;
+  uint64_t value;
+  uint32_t flags;
+  uint32_t crc;
+};
+
+class BenchRecordFrame : public FrameBase<BenchRecord, BenchRecordFrame> {
+ public:
+  static std::string staticName() { return "BenchRecordFrame"; }
+  explicit BenchRecordFrame(const std::string& instanceName)
+      : FrameBase(instanceName) {
+    registerSignal("value", &BenchRecord::value, &data_, &data_rwlock_);
+  }
+};
+
+int main(int argc, char** argv) {
+  BenchHarness harness(argc, argv);
+  size_t frameCount = 10000;
+  std::string path = "/tmp/nexum_checkpoint_bench.ckpt";
+  for (const auto& arg : harness.extraArgs()) {
+    if (arg.rfind("--frames=", 0) == 0) frameCount = std::stoul(arg.substr(9));
+    if (arg.rfind("--path=", 0) == 0) path = arg.substr(7);
+  }
+
+  std::vector<std::shared_ptr<BenchRecordFrame>> frames;
+  frames.reserve(frameCount);
+  for (size_t i = 0; i < frameCount; ++i) {
+    auto frame = std::make_shared<BenchRecordFrame>(
+        "bench.ckpt." + std::to_string(i));
+    FrameBus::instance().registerFrame(frame->id(), frame);
+    frames.push_back(std::move(frame));
+  }
+
+  // 왕복 검증: data() 직접 수정은 버전을 올리지 않음
+  for (size_t i = 0; i < frameCount; ++i)
+    frames[i]->data() = BenchRecord{i, i * 31 + 7, 1, 0};
+  BusCheckpoint::save(path);
+  for (auto& f : frames) f->data() = BenchRecord{};
+  const BusCheckpoint::Stats rs = BusCheckpoint::restore(path);
+  size_t bad = 0;
+  for (size_t i = 0; i < frameCount; ++i) {
+    const BenchRecord& d = frames[i]->data();
+    if (d.id != i || d.value != i * 31 + 7 || d.flags != 1) ++bad;
+  }
+  if (rs.restored != frameCount || bad != 0) {
+    std::fprintf(stderr,
+                 "checkpoint round trip failed: restored=%zu/%zu bad=%zu\n",
+                 rs.restored, frameCount, bad);
+    return 1;
+  }
+
+  harness.run("checkpoint/save/frames:" + std::to_string(frameCount), [&] {
+    return static_cast<uint64_t>(BusCheckpoint::save(path).frames);
+  });
+  harness.run("checkpoint/restore/frames:" + std::to_string(frameCount), [&] {
+    return static_cast<uint64_t>(BusCheckpoint::restore(path).restored);
+  });
+
+  std::remove(path.c_str());
+  return harness.finish();
+}
@@ -0,0 +1,180 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// FrameBus 경합 벤치마크: 샤드 FrameBus vs 단일 mutex 레지스트리
+//
+// 빌드 예:
+//   g++ -std=c++20 -O2 -pthread -I<include 상위> framebus_contention.cpp
+// 실행 예:
+//   ./a.out --reps=5 --json=framebus.json [--frames=10000] [--max-threads=32]
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "com/external/Interface/interface.h"
+#include "com/external/benchmark/BenchHarness.hpp"
+
+// --- 벤치마크용 최소 프레임 ---
+struct BenchWord {
+  uint64_t value;
+};
+
+class BenchWordFrame : public FrameBase<BenchWord, BenchWordFrame> {
+ public:
+  static std::string staticName() { return "BenchWordFrame"; }
+  explicit BenchWordFrame(const std::string& instanceName)
+      : FrameBase(instanceName) {
+    registerSignal("value", &BenchWord::value, &data_, &data_rwlock_);
+  }
+};
+
+// --- 비교 기준: 샤딩 이전 FrameBus 구현 (단일 mutex + unordered_map) ---
+class LegacyFrameBus {
+ public:
+  void registerFrame(const std::string& name, std::shared_ptr<IFrame> frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    frames_[name] = std::move(frame);
+  }
+  std::shared_ptr<IFrame> getFrame(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = frames_.find(name);
+    if (it != frames_.end()) return it->second;
+    return nullptr;
+  }
+  void unregisterFrame(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    frames_.erase(name);
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<IFrame>> frames_;
+};
+
+int main(int argc, char** argv) {
+  BenchHarness harness(argc, argv);
+  size_t frameCount = 10000;
+  size_t maxThreads = 32;
+  uint64_t opsPerThread = 200000;
+  for (const auto& arg : harness.extraArgs()) {
+    if (arg.rfind("--frames=", 0) == 0) frameCount = std::stoul(arg.substr(9));
+    if (arg.rfind("--max-threads=", 0) == 0)
+      maxThreads = std::stoul(arg.substr(14));
+    if (arg.rfind("--ops=", 0) == 0) opsPerThread = std::stoull(arg.substr(6));
+  }
+
+  (void)AutoRegister<BenchWordFrame, IFrame>::registered_;
+  LegacyFrameBus legacy;
+  std::vector<std::string> names;
+  names.reserve(frameCount);
+  for (size_t i = 0; i < frameCount; ++i) {
+    names.push_back("bench.frame." + std::to_string(i));
+    std::shared_ptr<IFrame> frame = FactoryRegistry<IFrame>::instance().create(
+        "BenchWordFrame", names.back());
+    FrameBus::instance().registerFrame(names.back(), frame);
+    legacy.registerFrame(names.back(), frame);
+  }
+  auto& sharded = FrameBus::instance();
+  const size_t n = names.size();
+  // 동적 프레임 이름은 측정 구간 밖에서 미리 만들어 둡니다.
+  std::vector<std::vector<std::string>> dynNames(maxThreads);
+  for (size_t t = 0; t < maxThreads; ++t)
+    for (size_t k = 0; k < 64; ++k)
+      dynNames[t].push_back("bench.dyn." + std::to_string(t) + "." +
+                            std::to_string(k));
+
+  for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+    const std::string suffix = "/threads:" + std::to_string(threads);
+
+    // 조회 전용
+    harness.run("framebus/lookup/legacy" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t i) {
+        auto f = legacy.getFrame(names[(i * 7919 + t * 104729) % n]);
+        (void)f;
+      });
+    });
+    harness.run("framebus/lookup/sharded" + suffix, [&] {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t i) {
+        auto f = sharded.getFrame(names[(i * 7919 + t * 104729) % n]);
+        (void)f;
+      });
+    });
+
+    // 조회 90% + 동적 프레임 생성/삭제 10%
+    auto mixed = [&](auto& bus) {
+      return runThreads(threads, opsPerThread, [&](size_t t, uint64_t i) {
+        if (i % 10 == 0) {
+          const std::string& dyn = dynNames[t][i % 64];
+          if (i % 20 == 0) {
+            bus.registerFrame(dyn, nullptr);
+          } else {
+            bus.unregisterFrame(dyn);
+          }
+        } else {
+          auto f = bus.getFrame(names[(i * 7919 + t * 104729) % n]);
+          (void)f;
+        }
+      });
+    };
+    harness.run("framebus/mixed/legacy" + suffix,
+                [&] { return mixed(legacy); });
+    harness.run("framebus/mixed/sharded" + suffix,
+                [&] { return mixed(sharded); });
+  }
+
+  // 전체 순회: 순차 vs 병렬
+  harness.run("framebus/forEach/sequential", [&] {
+    std::atomic<uint64_t> visited{0};
+    sharded.forEach([&](const std::string&, std::shared_ptr<IFrame>) {
+      visited.fetch_add(1, std::memory_order_relaxed);
+    });
+    return visited.load();
+  });
+  harness.run("framebus/forEach/parallel", [&] {
+    std::atomic<uint64_t> visited{0};
+    sharded.parallelForEach([&](const std::string&, std::shared_ptr<IFrame>) {
+      visited.fetch_add(1, std::memory_order_relaxed);
+    });
+    return visited.load();
+  });
+
+  return harness.finish();
+}
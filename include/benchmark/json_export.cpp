@@ -0,0 +1,193 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// 진단용 JSON 덤프 벤치마크: getSignal + std::any vs FrameJsonExporter
+//
+// 버스에 프레임 N개(기본 10000)를 등록하고 전체 덤프 1회(ns/op = 덤프 1회)
+// 비용을 비교합니다. legacy는 신호마다 getSignal()을 호출해 std::any를
+// 타입별로 캐스팅하고 ostringstream으로 포매팅하는 기존 진단 코드 방식,
+// export는 FrameJsonExporter::exportBus, stream은 64 KB 조각 스트리밍입니다.
+//
+// 빌드 예:
+//   g++ -std=c++20 -O2 -pthread -I<include 상위> json_export.cpp
+// 실행 예:
+//   ./a.out --reps=5 --json=json_export.json [--frames=10000]
+
+#include <array>
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+#include "com/external/Interface/interface.h"
+#include "com/external/benchmark/BenchHarness.hpp"
+
+struct DiagData {
+  uint32_t seq;
+  int16_t torque;
+  uint16_t rpm;
+  uint8_t gear;
+  bool valid;
+  float temp;
+  double timestamp;
+  std::array<int16_t, 4> wheel;
+  uint64_t odometer;
+};
+
+class DiagFrame : public FrameBase<DiagData, DiagFrame> {
+ public:
+  static std::string staticName() { return "DiagFrame"; }
+  explicit DiagFrame(const std::string& instanceName)
+      : FrameBase<DiagData, DiagFrame>(instanceName) {
+    registerSignal("seq", &DiagData::seq, &data_, &data_rwlock_);
+    registerSignal("torque", &DiagData::torque, &data_, &data_rwlock_);
+    registerSignal("rpm", &DiagData::rpm, &data_, &data_rwlock_);
+    registerSignal("gear", &DiagData::gear, &data_, &data_rwlock_);
+    registerSignal("valid", &DiagData::valid, &data_, &data_rwlock_);
+    registerSignal("temp", &DiagData::temp, &data_, &data_rwlock_);
+    registerSignal("timestamp", &DiagData::timestamp, &data_, &data_rwlock_);
+    registerSignal("wheel", &DiagData::wheel, &data_, &data_rwlock_);
+    registerSignal("odometer", &DiagData::odometer, &data_, &data_rwlock_);
+  }
+};
+
+// --- 기존 방식: 신호별 getSignal + std::any 캐스팅 ---
+template <typename T>
+bool writeAny(std::ostringstream& os, const std::any& v) {
+  const T* p = std::any_cast<T>(&v);
+  if (!p) return false;
+  if constexpr (std::is_same_v<T, bool>) {
+    os << (*p ? "true" : "false");
+  } else if constexpr (sizeof(T) == 1) {
+    os << static_cast<int>(*p);
+  } else {
+    os << *p;
+  }
+  return true;
+}
+
+void writeLegacy(std::ostringstream& os, const std::any& v) {
+  if (writeAny<bool>(os, v) || writeAny<uint8_t>(os, v) ||
+      writeAny<int16_t>(os, v) || writeAny<uint16_t>(os, v) ||
+      writeAny<uint32_t>(os, v) || writeAny<uint64_t>(os, v) ||
+      writeAny<float>(os, v) || writeAny<double>(os, v))
+    return;
+  if (const auto* a = std::any_cast<std::array<int16_t, 4>>(&v)) {
+    os << '[';
+    for (size_t i = 0; i < a->size(); ++i) os << (i ? "," : "") << (*a)[i];
+    os << ']';
+    return;
+  }
+  os << "null";
+}
+
+std::string legacyDump(const FrameBus& bus) {
+  std::ostringstream os;
+  os.precision(17);
+  os << '{';
+  bool firstFrame = true;
+  bus.forEach([&](const std::string& name, std::shared_ptr<IFrame> frame) {
+    if (!frame) return;
+    os << (firstFrame ? "" : ",") << '"' << name << "\":{";
+    firstFrame = false;
+    bool first = true;
+    for (const auto& e : frame->signalEntries()) {
+      os << (first ? "" : ",") << '"' << e.name << "\":";
+      first = false;
+      writeLegacy(os, frame->getSignal(e.name));
+    }
+    os << '}';
+  });
+  os << '}';
+  return os.str();
+}
+
+int main(int argc, char** argv) {
+  BenchHarness harness(argc, argv);
+  size_t frameCount = 10000;
+  for (const auto& arg : harness.extraArgs()) {
+    if (arg.rfind("--frames=", 0) == 0)
+      frameCount = std::stoul(arg.substr(9));
+  }
+
+  std::vector<std::shared_ptr<DiagFrame>> frames;
+  frames.reserve(frameCount);
+  for (size_t i = 0; i < frameCount; ++i) {
+    const std::string name = "diag." + std::to_string(i);
+    frames.push_back(std::make_shared<DiagFrame>(name));
+    frames.back()->writeRawData([i](char* p, size_t) {
+      auto* d = reinterpret_cast<DiagData*>(p);
+      d->seq = static_cast<uint32_t>(i);
+      d->torque = static_cast<int16_t>(i % 400) - 200;
+      d->rpm = static_cast<uint16_t>(800 + i % 6000);
+      d->gear = static_cast<uint8_t>(i % 7);
+      d->valid = i % 3 != 0;
+      d->temp = 20.0f + static_cast<float>(i % 300) / 10.0f;
+      d->timestamp = static_cast<double>(i) * 1e-3;
+      d->wheel = {static_cast<int16_t>(i % 100), -3, 7, 0};
+      d->odometer = 1000000 + i * 17;
+    });
+    FrameBus::instance().registerFrame(name, frames.back());
+  }
+  const FrameBus& bus = FrameBus::instance();
+
+  size_t dumpBytes = 0;
+  if (BenchResult* r = harness.run("json/legacy_any", [&] {
+        dumpBytes = legacyDump(bus).size();
+        return uint64_t{1};
+      }))
+    r->metrics.emplace_back("dump_bytes", static_cast<double>(dumpBytes));
+
+  FrameJsonExporter exporter;
+  if (BenchResult* r = harness.run("json/export", [&] {
+        dumpBytes = exporter.exportBus(bus).size();
+        return uint64_t{1};
+      }))
+    r->metrics.emplace_back("dump_bytes", static_cast<double>(dumpBytes));
+
+  if (BenchResult* r = harness.run("json/stream", [&] {
+        dumpBytes = 0;
+        exporter.streamBus(
+            [&](std::string_view chunk) { dumpBytes += chunk.size(); }, bus);
+        return uint64_t{1};
+      }))
+    r->metrics.emplace_back("dump_bytes", static_cast<double>(dumpBytes));
+
+  return harness.finish();
+}
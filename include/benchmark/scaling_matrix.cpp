@@ -0,0 +1,334 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// 확장성 매트릭스 벤치마크: 송신 스레드 x 프레임 수 x 구독자 수 x 전달 정책
+//
+// 각 조합에서 전체 전달(콜백) 처리량을 측정하고, 같은 (정책, 프레임,
+// 구독자) 계열 안에서 송신 스레드 1개 대비 확장 효율을 계산합니다.
+// 이어서 전역 락 후보(FrameBus 샤드 락, 프레임별 cb_mutex_,
+// FactoryRegistry::mutex_)를 단독으로 측정해 어느 지점에서 확장이
+// 멈추는지 표시합니다.
+//
+// 확장 효율 = 처리량(P) / (처리량(1) * min(P, 코어 수))
+//
+// 빌드 예:
+//   g++ -std=c++20 -O2 -pthread -I<include 상위> scaling_matrix.cpp
+// 실행 예:
+//   ./a.out --reps=5 --json=scaling.json
+//           [--publishers=1,2,4,8,16,32,64] [--frames=1,10,100,1000,10000]
+//           [--subs=1,10,100] [--policies=direct,threaded]
+//           [--publishes=20000] [--max-threads=2048] [--efficiency=0.5]
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "com/external/Interface/interface.h"
+#include "com/external/benchmark/BenchHarness.hpp"
+
+// --- 벤치마크용 최소 프레임 ---
+struct ScaleWord {
+  uint64_t value;
+};
+
+class ScaleFrame : public FrameBase<ScaleWord, ScaleFrame> {
+ public:
+  static std::string staticName() { return "ScaleFrame"; }
+  explicit ScaleFrame(const std::string& instanceName)
+      : FrameBase(instanceName) {
+    registerSignal("value", &ScaleWord::value, &data_, &data_rwlock_);
+  }
+};
+
+// 구독자별 전달 카운터 (구독자 간 캐시 라인 공유 방지)
+struct alignas(64) DeliveryCounter {
+  std::atomic<uint64_t> n{0};
+};
+
+static std::vector<size_t> parseList(const std::string& s) {
+  std::vector<size_t> out;
+  std::istringstream ss(s);
+  std::string item;
+  while (std::getline(ss, item, ',')) out.push_back(std::stoul(item));
+  return out;
+}
+
+/**
+ * @brief 계열별 확장 효율 계산 및 표시
+ */
+class ScalingTracker {
+ public:
+  explicit ScalingTracker(double threshold)
+      : threshold_(threshold),
+        cores_(std::max(1u, std::thread::hardware_concurrency())) {}
+
+  /**
+   * @brief 결과 기록 (series의 첫 호출은 publishers=1이어야 기준이 됨)
+   */
+  void record(const std::string& series, size_t publishers, BenchResult* r) {
+    if (!r) return;
+    const double med = r->median();
+    const double throughput = med > 0 ? 1e9 / med : 0.0;
+    if (publishers == 1) base_[series] = throughput;
+    r->metrics.emplace_back("throughput_ops_s", throughput);
+    auto it = base_.find(series);
+    if (it == base_.end() || it->second <= 0) return;
+    const double ideal =
+        it->second * double(std::min<size_t>(publishers, cores_));
+    const double eff = throughput / ideal;
+    r->metrics.emplace_back("scaling_efficiency", eff);
+    if (publishers > 1 && eff < threshold_ && !flagged_[series]) {
+      flagged_[series] = true;
+      std::printf("  ^ %s stops scaling at %zu publishers "
+                  "(efficiency %.2f < %.2f)\n",
+                  series.c_str(), publishers, eff, threshold_);
+      stops_.push_back(series + " @ " + std::to_string(publishers));
+    }
+  }
+
+  /**
+   * @brief 확장이 멈춘 계열 요약 출력
+   */
+  void summary() const {
+    std::printf("\nhardware threads: %zu\n", cores_);
+    if (stops_.empty()) {
+      std::printf("all series scaled above efficiency %.2f\n", threshold_);
+      return;
+    }
+    std::printf("series that stop scaling (first publisher count below "
+                "%.2f):\n",
+                threshold_);
+    for (const auto& s : stops_) std::printf("  %s\n", s.c_str());
+  }
+
+ private:
+  double threshold_;
+  size_t cores_;
+  std::map<std::string, double> base_;
+  std::map<std::string, bool> flagged_;
+  std::vector<std::string> stops_;
+};
+
+/**
+ * @brief (정책, 프레임 수, 구독자 수) 1개 계열의 프레임 그래프
+ */
+class ScaleGraph {
+ public:
+  ScaleGraph(bool threaded, size_t frames, size_t subs) : threaded_(threaded) {
+    counters_.reserve(frames * subs);
+    for (size_t f = 0; f < frames; ++f) {
+      frames_.emplace_back(FactoryRegistry<IFrame>::instance().create(
+          "ScaleFrame", "scale.frame." + std::to_string(f)));
+      for (size_t s = 0; s < subs; ++s) {
+        counters_.push_back(std::make_unique<DeliveryCounter>());
+        DeliveryCounter* c = counters_.back().get();
+        if (threaded) {
+          frames_.back()->addSnapshotCallback(
+              [c](const std::vector<uint8_t>&, size_t) {
+                c->n.fetch_add(1, std::memory_order_relaxed);
+              });
+        } else {
+          frames_.back()->addCallback(
+              [c](const IFrame&) {
+                c->n.fetch_add(1, std::memory_order_relaxed);
+              },
+              CallbackPolicy::Direct);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief publishes회 송신 후 모든 전달이 끝날 때까지 대기
+   * @return 전달 수
+   */
+  uint64_t publish(size_t publishers, uint64_t publishes) {
+    const uint64_t before = delivered();
+    const size_t n = frames_.size();
+    runThreads(publishers, publishes / publishers, [&](size_t t, uint64_t i) {
+      // 프레임 수가 스레드 수보다 적으면 스레드들이 같은 프레임을 공유
+      frames_[(i * publishers + t) % n]->setSignalWithPublish(
+          "value", uint64_t{i});
+    });
+    const uint64_t expected =
+        (publishes / publishers) * publishers * (counters_.size() / n);
+    if (threaded_)
+      while (delivered() - before < expected) std::this_thread::yield();
+    return expected;
+  }
+
+ private:
+  uint64_t delivered() const {
+    uint64_t sum = 0;
+    for (const auto& c : counters_) sum += c->n.load(std::memory_order_relaxed);
+    return sum;
+  }
+
+  bool threaded_;
+  std::vector<std::unique_ptr<IFrame>> frames_;
+  std::vector<std::unique_ptr<DeliveryCounter>> counters_;
+};
+
+int main(int argc, char** argv) {
+  BenchHarness harness(argc, argv);
+  std::vector<size_t> publishers{1, 2, 4, 8, 16, 32, 64};
+  std::vector<size_t> frameCounts{1, 10, 100, 1000, 10000};
+  std::vector<size_t> subCounts{1, 10, 100};
+  std::vector<std::string> policies{"direct", "threaded"};
+  uint64_t publishes = 20000;
+  size_t maxThreads = 2048;  // Threaded 정책은 구독마다 스레드 1개
+  double threshold = 0.5;
+  for (const auto& arg : harness.extraArgs()) {
+    if (arg.rfind("--publishers=", 0) == 0)
+      publishers = parseList(arg.substr(13));
+    if (arg.rfind("--frames=", 0) == 0) frameCounts = parseList(arg.substr(9));
+    if (arg.rfind("--subs=", 0) == 0) subCounts = parseList(arg.substr(7));
+    if (arg.rfind("--policies=", 0) == 0) {
+      policies.clear();
+      std::istringstream ss(arg.substr(11));
+      std::string p;
+      while (std::getline(ss, p, ',')) policies.push_back(p);
+    }
+    if (arg.rfind("--publishes=", 0) == 0)
+      publishes = std::stoull(arg.substr(12));
+    if (arg.rfind("--max-threads=", 0) == 0)
+      maxThreads = std::stoul(arg.substr(14));
+    if (arg.rfind("--efficiency=", 0) == 0)
+      threshold = std::stod(arg.substr(13));
+  }
+
+  (void)AutoRegister<ScaleFrame, IFrame>::registered_;
+  ScalingTracker tracker(threshold);
+
+  // --- 전달 처리량 매트릭스 ---
+  for (const auto& policy : policies) {
+    const bool threaded = policy == "threaded";
+    for (size_t frames : frameCounts) {
+      for (size_t subs : subCounts) {
+        const std::string series = "scaling/" + policy + "/frames:" +
+                                   std::to_string(frames) +
+                                   "/subs:" + std::to_string(subs);
+        if (!harness.enabled(series)) continue;
+        if (threaded && frames * subs > maxThreads) {
+          std::printf("%-56s skipped (%zu callback threads > "
+                      "--max-threads=%zu)\n",
+                      series.c_str(), frames * subs, maxThreads);
+          continue;
+        }
+        ScaleGraph graph(threaded, frames, subs);
+        for (size_t p : publishers) {
+          BenchResult* r =
+              harness.run(series + "/pub:" + std::to_string(p),
+                          [&] { return graph.publish(p, publishes); });
+          tracker.record(series, p, r);
+        }
+      }
+    }
+  }
+
+  // --- 락 프로브: 전역/공유 락을 단독으로 측정 ---
+  const uint64_t probeOps = 100000;
+  std::vector<std::string> names;
+  std::vector<std::shared_ptr<IFrame>> busFrames;
+  const bool busProbe = harness.enabled("lock/framebus");
+  for (size_t i = 0; busProbe && i < 10000; ++i) {
+    names.push_back("scale.bus." + std::to_string(i));
+    busFrames.emplace_back(FactoryRegistry<IFrame>::instance().create(
+        "ScaleFrame", names.back()));
+    FrameBus::instance().registerFrame(names.back(), busFrames.back());
+  }
+  std::shared_ptr<IFrame> shared = FactoryRegistry<IFrame>::instance().create(
+      "ScaleFrame", "scale.shared");
+  shared->addCallback([](const IFrame&) {}, CallbackPolicy::Direct);
+  std::vector<std::unique_ptr<IFrame>> privateFrames;
+  for (size_t i = 0; i < 64; ++i) {
+    privateFrames.emplace_back(FactoryRegistry<IFrame>::instance().create(
+        "ScaleFrame", "scale.private." + std::to_string(i)));
+    privateFrames.back()->addCallback([](const IFrame&) {},
+                                      CallbackPolicy::Direct);
+  }
+
+  for (size_t p : publishers) {
+    const std::string suffix = "/pub:" + std::to_string(p);
+    const uint64_t perThread = probeOps / p;
+    if (busProbe) {
+      // FrameBus 샤드 shared_mutex (조회)
+      tracker.record("lock/framebus/lookup", p,
+                     harness.run("lock/framebus/lookup" + suffix, [&] {
+                       return runThreads(p, perThread, [&](size_t t,
+                                                           uint64_t i) {
+                         auto f = FrameBus::instance().getFrame(
+                             names[(i * 7919 + t * 104729) % names.size()]);
+                         (void)f;
+                       });
+                     }));
+    }
+    // 프레임 1개의 cb_mutex_를 모든 스레드가 공유
+    tracker.record("lock/frame_cb_mutex/shared", p,
+                   harness.run("lock/frame_cb_mutex/shared" + suffix, [&] {
+                     return runThreads(p, perThread, [&](size_t, uint64_t) {
+                       shared->notifyCallbacks();
+                     });
+                   }));
+    // 대조군: 스레드마다 다른 프레임
+    tracker.record("lock/frame_cb_mutex/private", p,
+                   harness.run("lock/frame_cb_mutex/private" + suffix, [&] {
+                     return runThreads(p, perThread, [&](size_t t, uint64_t) {
+                       privateFrames[t % privateFrames.size()]
+                           ->notifyCallbacks();
+                     });
+                   }));
+    // FactoryRegistry<IFrame>::mutex_ (생성 전체가 락 안에서 실행)
+    tracker.record(
+        "lock/factory_registry/create", p,
+        harness.run("lock/factory_registry/create" + suffix, [&] {
+          return runThreads(p, perThread / 10, [&](size_t, uint64_t) {
+            auto f = FactoryRegistry<IFrame>::instance().create(
+                "ScaleFrame", "scale.tmp");
+            (void)f;
+          });
+        }));
+  }
+  for (const auto& name : names) FrameBus::instance().unregisterFrame(name);
+
+  tracker.summary();
+  return harness.finish();
+}
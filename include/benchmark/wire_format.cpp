@@ -0,0 +1,336 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// 와이어 포맷 벤치마크: 원본 구조체(memcpy) vs CompactCodec vs ZeroCopy
+//
+// 대표 페이로드 3종(꽉 찬 CAN 8바이트, 작은 값 위주 텔레메트리,
+// 대부분 0인 4 KB 프레임)에 대해 프레임 직렬화/역직렬화 비용과
+// 와이어 바이트 수(wire_bytes 지표)를 비교합니다. read2는 수신 버퍼에서
+// 신호 2개만 읽는 소비자 비용입니다 (raw/compact: 역직렬화 후 읽기,
+// zerocopy: 버퍼 위 ZeroCopyView에서 바로 읽기).
+// subscribe/*는 publish 1회당 구독 전달 비용입니다 (subscribeFrame:
+// 스냅샷 복사 + 스레드 큐, direct: 원본을 구조체로 복사 후 읽기,
+// view: subscribeFrameView로 프레임 데이터 위에서 바로 읽기).
+//
+// 빌드 예:
+//   g++ -std=c++20 -O2 -pthread -I<include 상위> wire_format.cpp
+// 실행 예:
+//   ./a.out --reps=5 --json=wire.json [--ops=200000] [--density=0.01]
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "com/external/Interface/interface.h"
+#include "com/external/benchmark/BenchHarness.hpp"
+
+// --- 페이로드 정의 (신호 등록 함수 포함) ---
+struct Can8 {
+  uint16_t rpm;
+  int16_t torque;
+  uint8_t gear;
+  uint8_t flags;
+  uint16_t speed;
+
+  static constexpr const char* kName = "can8";
+  static void registerSignals(IFrame& f, Can8* d, std::shared_mutex* lock) {
+    f.registerSignal("rpm", &Can8::rpm, d, lock);
+    f.registerSignal("torque", &Can8::torque, d, lock);
+    f.registerSignal("gear", &Can8::gear, d, lock);
+    f.registerSignal("flags", &Can8::flags, d, lock);
+    f.registerSignal("speed", &Can8::speed, d, lock);
+  }
+  static double probe(const Can8& d) { return d.rpm + d.speed; }
+  static double probeView(const ZeroCopyView& v) {
+    static const ZeroCopyField<uint16_t> rpm("rpm"), speed("speed");
+    return rpm(v) + speed(v);
+  }
+  static void fill(Can8& d, std::mt19937_64& rng, double) {
+    d.rpm = static_cast<uint16_t>(rng());
+    d.torque = static_cast<int16_t>(rng());
+    d.gear = static_cast<uint8_t>(rng() % 8);
+    d.flags = static_cast<uint8_t>(rng());
+    d.speed = static_cast<uint16_t>(rng());
+  }
+};
+
+struct Telemetry {
+  uint32_t seq;
+  int32_t pos[3];
+  float temp;
+  uint16_t status;
+  uint8_t mode;
+  double timestamp;
+  std::array<int16_t, 16> samples;
+
+  static constexpr const char* kName = "telemetry";
+  static void registerSignals(IFrame& f, Telemetry* d,
+                              std::shared_mutex* lock) {
+    f.registerSignal("seq", &Telemetry::seq, d, lock);
+    f.registerSignal("temp", &Telemetry::temp, d, lock);
+    f.registerSignal("status", &Telemetry::status, d, lock);
+    f.registerSignal("mode", &Telemetry::mode, d, lock);
+    f.registerSignal("timestamp", &Telemetry::timestamp, d, lock);
+    f.registerSignal("samples", &Telemetry::samples, d, lock);
+  }
+  static double probe(const Telemetry& d) { return d.seq + d.samples[15]; }
+  static double probeView(const ZeroCopyView& v) {
+    static const ZeroCopyField<uint32_t> seq("seq");
+    static const ZeroCopyField<int16_t> samples("samples");
+    return seq(v) + samples.array(v)[15];
+  }
+  static void fill(Telemetry& d, std::mt19937_64& rng, double) {
+    d.seq = static_cast<uint32_t>(rng() % 100000);
+    for (auto& p : d.pos) p = static_cast<int32_t>(rng() % 2001) - 1000;
+    d.temp = 20.0f + static_cast<float>(rng() % 100) / 10.0f;
+    d.status = static_cast<uint16_t>(rng() % 4 == 0 ? rng() % 16 : 0);
+    d.mode = static_cast<uint8_t>(rng() % 3);
+    d.timestamp = static_cast<double>(rng() % 1000000) * 1e-3;
+    for (auto& s : d.samples) s = static_cast<int16_t>(rng() % 201) - 100;
+  }
+};
+
+struct Sparse4k {
+  uint32_t seq;
+  uint16_t count;
+  uint8_t payload[4090];
+
+  static constexpr const char* kName = "sparse4k";
+  static void registerSignals(IFrame& f, Sparse4k* d,
+                              std::shared_mutex* lock) {
+    f.registerSignal("seq", &Sparse4k::seq, d, lock);
+    f.registerSignal("count", &Sparse4k::count, d, lock);
+  }
+  static double probe(const Sparse4k& d) { return d.seq + d.count; }
+  static double probeView(const ZeroCopyView& v) {
+    static const ZeroCopyField<uint32_t> seq("seq");
+    static const ZeroCopyField<uint16_t> count("count");
+    return seq(v) + count(v);
+  }
+  static void fill(Sparse4k& d, std::mt19937_64& rng, double density) {
+    d = Sparse4k{};
+    d.seq = static_cast<uint32_t>(rng() % 100000);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    for (auto& b : d.payload) {
+      if (u(rng) < density) {
+        b = static_cast<uint8_t>(1 + rng() % 255);
+        ++d.count;
+      }
+    }
+  }
+};
+
+// --- 벤치마크 프레임 ---
+enum class WireFormat { Raw, Compact, ZeroCopy };
+
+inline const char* formatName(WireFormat f) {
+  switch (f) {
+    case WireFormat::Compact:
+      return "compact";
+    case WireFormat::ZeroCopy:
+      return "zerocopy";
+    default:
+      return "raw";
+  }
+}
+
+template <typename DataT, WireFormat Format>
+class WireFrame : public FrameBase<DataT, WireFrame<DataT, Format>> {
+ public:
+  using Base = FrameBase<DataT, WireFrame<DataT, Format>>;
+  static std::string staticName() {
+    return std::string("WireFrame.") + DataT::kName + "." +
+           formatName(Format);
+  }
+  explicit WireFrame(const std::string& instanceName) : Base(instanceName) {
+    DataT::registerSignals(*this, &this->data_, &this->data_rwlock_);
+    if constexpr (Format == WireFormat::Compact) this->setCompactEncoding();
+    if constexpr (Format == WireFormat::ZeroCopy) this->setZeroCopyEncoding();
+  }
+};
+
+// --- 구독 경로 측정용 최소 포트 ---
+class BenchPort : public PortBase<BenchPort> {
+ public:
+  using PortBase::PortBase;
+  static std::string staticName() { return "BenchPort"; }
+  std::string type() const override { return "bench"; }
+  bool open() override { return true; }
+  void close() override {}
+};
+
+/**
+ * @brief 구독 방식별 publish 1회당 전달 + 신호 2개 읽기 비용 측정
+ */
+template <typename DataT>
+void runSubscribe(BenchHarness& harness, uint64_t ops,
+                  const DataT& sample) {
+  using Frame = WireFrame<DataT, WireFormat::Raw>;
+  const std::string prefix = std::string("wire/") + DataT::kName +
+                             "/subscribe/";
+  const std::string name = prefix + "frame";
+  auto frame = std::make_shared<Frame>(name);
+  frame->writeRawData(
+      [&](char* p, size_t n) { std::memcpy(p, &sample, n); });
+  FrameBus::instance().registerFrame(name, frame);
+  BenchPort port(prefix + "port");
+  port.connectFrame(name);
+
+  std::atomic<uint64_t> delivered{0};
+  double acc = 0;
+  auto publishAll = [&](uint64_t id) {
+    delivered.store(0, std::memory_order_relaxed);
+    for (uint64_t i = 0; i < ops; ++i) frame->notifyCallbacks();
+    while (delivered.load(std::memory_order_acquire) < ops)
+      std::this_thread::yield();  // subscribeFrame은 비동기 전달
+    port.unsubscribeFrame(id);
+    return ops;
+  };
+  auto copyProbe = [&](const char* p, size_t) {
+    DataT d;
+    std::memcpy(&d, p, sizeof(DataT));
+    acc += DataT::probe(d);
+    delivered.fetch_add(1, std::memory_order_release);
+  };
+  harness.run(prefix + "frame", [&] {
+    return publishAll(port.subscribeFrame(name, copyProbe));
+  });
+  harness.run(prefix + "direct", [&] {
+    return publishAll(port.subscribeFrameDirect(name, copyProbe));
+  });
+  harness.run(prefix + "view", [&] {
+    return publishAll(port.subscribeFrameView(name, [&](const ZeroCopyView& v) {
+      acc += DataT::probeView(v);
+      delivered.fetch_add(1, std::memory_order_release);
+    }));
+  });
+  volatile double sink = acc;
+  (void)sink;
+  FrameBus::instance().unregisterFrame(name);
+}
+
+/**
+ * @brief 한 페이로드 종류에 대해 포맷별 인코딩/디코딩/부분 읽기 측정
+ */
+template <typename DataT>
+void runWorkload(BenchHarness& harness, uint64_t ops, double density) {
+  constexpr size_t kSamples = 64;
+  std::mt19937_64 rng(42);
+  std::vector<DataT> samples(kSamples);
+  for (auto& s : samples) DataT::fill(s, rng, density);
+
+  auto measure = [&](auto tag) {
+    constexpr WireFormat kFormat = decltype(tag)::value;
+    using Frame = WireFrame<DataT, kFormat>;
+    const std::string prefix = std::string("wire/") + DataT::kName + "/" +
+                               formatName(kFormat);
+    std::vector<std::unique_ptr<Frame>> tx;
+    std::vector<std::vector<std::byte>> wire(kSamples);
+    double wireBytes = 0;
+    for (size_t i = 0; i < kSamples; ++i) {
+      tx.push_back(std::make_unique<Frame>(prefix + ".tx"));
+      tx.back()->writeRawData([&](char* p, size_t n) {
+        std::memcpy(p, &samples[i], n);
+      });
+      wire[i].resize(tx.back()->serializedSize());
+      wire[i].resize(tx.back()->serializeInto(wire[i]));
+      wireBytes += static_cast<double>(wire[i].size());
+    }
+    wireBytes /= kSamples;
+    Frame rx(prefix + ".rx");
+    std::vector<std::byte> out(tx.front()->serializedSize());
+
+    auto addSize = [&](BenchResult* r) {
+      if (!r) return;
+      r->metrics.emplace_back("wire_bytes", wireBytes);
+      r->metrics.emplace_back("raw_bytes", static_cast<double>(sizeof(DataT)));
+    };
+    addSize(harness.run(prefix + "/encode", [&] {
+      for (uint64_t i = 0; i < ops; ++i) tx[i % kSamples]->serializeInto(out);
+      return ops;
+    }));
+    addSize(harness.run(prefix + "/decode", [&] {
+      for (uint64_t i = 0; i < ops; ++i)
+        rx.deserializeFrom(wire[i % kSamples]);
+      return ops;
+    }));
+    volatile double sink = 0;
+    harness.run(prefix + "/read2", [&] {
+      double acc = 0;
+      for (uint64_t i = 0; i < ops; ++i) {
+        const auto& buf = wire[i % kSamples];
+        if constexpr (kFormat == WireFormat::ZeroCopy) {
+          acc += DataT::probeView(ZeroCopyView::parse(buf));
+        } else {
+          rx.deserializeFrom(buf);
+          acc += DataT::probe(rx.data());
+        }
+      }
+      sink = acc;
+      return ops;
+    });
+    (void)sink;
+  };
+  measure(std::integral_constant<WireFormat, WireFormat::Raw>{});
+  measure(std::integral_constant<WireFormat, WireFormat::Compact>{});
+  measure(std::integral_constant<WireFormat, WireFormat::ZeroCopy>{});
+  runSubscribe<DataT>(harness, ops, samples.front());
+}
+
+int main(int argc, char** argv) {
+  BenchHarness harness(argc, argv);
+  uint64_t ops = 200000;
+  double density = 0.01;
+  for (const auto& arg : harness.extraArgs()) {
+    if (arg.rfind("--ops=", 0) == 0) ops = std::stoull(arg.substr(6));
+    if (arg.rfind("--density=", 0) == 0) density = std::stod(arg.substr(10));
+  }
+
+  runWorkload<Can8>(harness, ops, density);
+  runWorkload<Telemetry>(harness, ops, density);
+  runWorkload<Sparse4k>(harness, ops / 10, density);
+
+  return harness.finish();
+}
@@ -0,0 +1,531 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// 벤치마크 결과 비교 / 회귀 게이트 도구
+//
+// BenchHarness --json 결과 두 개(기준, 후보)를 읽어 벤치마크별 반복 실행
+// 표본(ns_per_op)에 Mann-Whitney U 검정을 적용합니다. 중앙값이
+// --threshold 이상 느려지고 p < --alpha 이면 회귀로 판정하며, 회귀가
+// 하나라도 있으면 종료 코드 1을 반환합니다.
+//
+// 반복 횟수가 적으면 표본을 완전히 분리해도 p가 alpha 아래로 내려가지
+// 않습니다(예: 3회 대 3회의 최소 p = 0.1). 이런 벤치마크는
+// "underpowered"로 표시하고 게이트를 실패시킵니다. 양쪽 5회(BenchHarness
+// 기본값)면 alpha 0.05에서 판정이 가능합니다.
+//
+// 기준선 이력 파일(--history)은 한 줄에 결과 1건(JSON)을 기록하며,
+// --baseline=history 로 최근 --history-depth 건의 표본을 합쳐 기준으로
+// 사용할 수 있습니다. --record 지정 시 게이트를 통과한 후보를 이력에
+// 추가합니다.
+//
+// 빌드 예:
+//   g++ -std=c++20 -O2 -I<include 상위> bench_compare.cpp
+// 실행 예:
+//   ./a.out base.json cand.json [--threshold=5] [--alpha=0.05]
+//   ./a.out --history=bench.hist --baseline=history cand.json --record
+//
+// 종료 코드: 0 통과, 1 회귀 또는 검정력 부족, 2 입력/사용법 오류
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// --- 최소 JSON 파서 (BenchHarness 출력 / 이력 파일용) ---
+struct JsonValue {
+  enum class Kind { Null, Bool, Number, String, Array, Object };
+  Kind kind = Kind::Null;
+  bool boolean = false;
+  double number = 0;
+  std::string string;
+  std::vector<JsonValue> array;
+  std::vector<std::pair<std::string, JsonValue>> object;
+
+  const JsonValue* find(const std::string& key) const {
+    for (const auto& [k, v] : object)
+      if (k == key) return &v;
+    return nullptr;
+  }
+};
+
+class JsonParser {
+ public:
+  explicit JsonParser(const std::string& text) : s_(text) {}
+
+  JsonValue parse() {
+    JsonValue v = value();
+    skipWs();
+    if (pos_ != s_.size()) fail("trailing characters");
+    return v;
+  }
+
+ private:
+  [[noreturn]] void fail(const std::string& what) const {
+    throw std::runtime_error("JSON: " + what + " at offset " +
+                             std::to_string(pos_));
+  }
+
+  void skipWs() {
+    while (pos_ < s_.size() &&
+           std::isspace(static_cast<unsigned char>(s_[pos_])))
+      ++pos_;
+  }
+
+  char peek() {
+    skipWs();
+    if (pos_ >= s_.size()) fail("unexpected end");
+    return s_[pos_];
+  }
+
+  void expect(char c) {
+    if (peek() != c) fail(std::string("expected '") + c + "'");
+    ++pos_;
+  }
+
+  JsonValue value() {
+    const char c = peek();
+    JsonValue v;
+    if (c == '{') {
+      v.kind = JsonValue::Kind::Object;
+      ++pos_;
+      if (peek() == '}') {
+        ++pos_;
+        return v;
+      }
+      for (;;) {
+        std::string key = str();
+        expect(':');
+        v.object.emplace_back(std::move(key), value());
+        if (peek() == ',') {
+          ++pos_;
+          continue;
+        }
+        expect('}');
+        return v;
+      }
+    }
+    if (c == '[') {
+      v.kind = JsonValue::Kind::Array;
+      ++pos_;
+      if (peek() == ']') {
+        ++pos_;
+        return v;
+      }
+      for (;;) {
+        v.array.push_back(value());
+        if (peek() == ',') {
+          ++pos_;
+          continue;
+        }
+        expect(']');
+        return v;
+      }
+    }
+    if (c == '"') {
+      v.kind = JsonValue::Kind::String;
+      v.string = str();
+      return v;
+    }
+    if (s_.compare(pos_, 4, "true") == 0 || s_.compare(pos_, 5, "false") == 0) {
+      v.kind = JsonValue::Kind::Bool;
+      v.boolean = s_[pos_] == 't';
+      pos_ += v.boolean ? 4 : 5;
+      return v;
+    }
+    if (s_.compare(pos_, 4, "null") == 0) {
+      pos_ += 4;
+      return v;
+    }
+    size_t used = 0;
+    try {
+      v.number = std::stod(s_.substr(pos_, 64), &used);
+    } catch (const std::exception&) {
+      fail("invalid value");
+    }
+    v.kind = JsonValue::Kind::Number;
+    pos_ += used;
+    return v;
+  }
+
+  std::string str() {
+    expect('"');
+    std::string out;
+    while (pos_ < s_.size() && s_[pos_] != '"') {
+      char c = s_[pos_++];
+      if (c == '\\') {
+        if (pos_ >= s_.size()) fail("bad escape");
+        c = s_[pos_++];
+        if (c == 'n') c = '\n';
+        else if (c == 't') c = '\t';
+        else if (c == 'u') {  // 벤치마크 이름에는 ASCII만 사용: 그대로 보존
+          out += "\\u";
+          continue;
+        }
+      }
+      out.push_back(c);
+    }
+    if (pos_ >= s_.size()) fail("unterminated string");
+    ++pos_;
+    return out;
+  }
+
+  const std::string& s_;
+  size_t pos_ = 0;
+};
+
+// --- 결과 집합 ---
+using Samples = std::map<std::string, std::vector<double>>;
+
+/**
+ * @brief nexum-bench 형식 객체에서 벤치마크별 표본을 추출해 누적
+ */
+static void collectSamples(const JsonValue& doc, Samples& out) {
+  const JsonValue* format = doc.find("format");
+  if (!format || format->string != "nexum-bench")
+    throw std::runtime_error("not a nexum-bench result");
+  const JsonValue* benches = doc.find("benchmarks");
+  if (!benches || benches->kind != JsonValue::Kind::Array)
+    throw std::runtime_error("missing benchmarks array");
+  for (const auto& b : benches->array) {
+    const JsonValue* name = b.find("name");
+    const JsonValue* ns = b.find("ns_per_op");
+    if (!name || !ns) continue;
+    auto& v = out[name->string];
+    for (const auto& x : ns->array) v.push_back(x.number);
+  }
+}
+
+static std::string readFile(const std::string& path) {
+  std::ifstream in(path);
+  if (!in) throw std::runtime_error("cannot read " + path);
+  std::ostringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+/**
+ * @brief 이력 파일의 최근 depth건 (한 줄 = {"label","time","result"})
+ */
+static std::vector<JsonValue> readHistory(const std::string& path,
+                                          size_t depth) {
+  std::ifstream in(path);
+  std::vector<JsonValue> entries;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+    entries.push_back(JsonParser(line).parse());
+  }
+  if (entries.size() > depth)
+    entries.erase(entries.begin(), entries.end() - depth);
+  return entries;
+}
+
+static void appendHistory(const std::string& path, const std::string& label,
+                          const std::string& resultText) {
+  std::string flat, quoted;
+  for (char c : resultText)
+    if (c != '\n' && c != '\r') flat.push_back(c);
+  for (char c : label) {
+    if (c == '"' || c == '\\') quoted.push_back('\\');
+    quoted.push_back(c);
+  }
+  const auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                       std::chrono::system_clock::now().time_since_epoch())
+                       .count();
+  std::ofstream out(path, std::ios::app);
+  if (!out) throw std::runtime_error("cannot append " + path);
+  out << "{\"label\":\"" << quoted << "\",\"time\":" << now
+      << ",\"result\":" << flat << "}\n";
+}
+
+// --- 통계 ---
+static double median(std::vector<double> v) {
+  if (v.empty()) return 0.0;
+  std::sort(v.begin(), v.end());
+  const size_t n = v.size();
+  return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2.0;
+}
+
+/**
+ * @brief 양측 Mann-Whitney U 검정 p값
+ *
+ * 동순위가 없고 표본이 작으면(합계 20개 이하) U의 정확 분포를, 그 밖에는
+ * 동순위 보정과 연속성 보정을 적용한 정규 근사를 사용합니다.
+ */
+static double mannWhitneyP(const std::vector<double>& a,
+                           const std::vector<double>& b) {
+  const size_t n1 = a.size(), n2 = b.size();
+  if (n1 == 0 || n2 == 0) return 1.0;
+  std::vector<std::pair<double, int>> all;
+  for (double x : a) all.emplace_back(x, 0);
+  for (double x : b) all.emplace_back(x, 1);
+  std::sort(all.begin(), all.end());
+
+  const size_t n = all.size();
+  double rankSumA = 0, tieTerm = 0;
+  bool ties = false;
+  for (size_t i = 0; i < n;) {
+    size_t j = i;
+    while (j < n && all[j].first == all[i].first) ++j;
+    const double rank = (double(i + 1) + double(j)) / 2.0;  // 평균 순위
+    const double t = double(j - i);
+    if (t > 1) ties = true;
+    tieTerm += t * t * t - t;
+    for (size_t k = i; k < j; ++k)
+      if (all[k].second == 0) rankSumA += rank;
+    i = j;
+  }
+  const double u1 = rankSumA - double(n1) * double(n1 + 1) / 2.0;
+  const double u = std::min(u1, double(n1) * double(n2) - u1);
+
+  if (!ties && n <= 20) {
+    // c[i][j][x]: 크기 (i, j) 표본 배치 중 U = x 인 경우의 수
+    //   c(i, j, x) = c(i-1, j, x-j) + c(i, j-1, x)
+    const size_t maxU = n1 * n2;
+    std::vector<std::vector<std::vector<double>>> c(
+        n1 + 1, std::vector<std::vector<double>>(
+                    n2 + 1, std::vector<double>(maxU + 1, 0.0)));
+    for (size_t i = 0; i <= n1; ++i) {
+      for (size_t j = 0; j <= n2; ++j) {
+        if (i == 0 || j == 0) {
+          c[i][j][0] = 1;
+          continue;
+        }
+        for (size_t x = 0; x <= i * j; ++x)
+          c[i][j][x] = (x >= j ? c[i - 1][j][x - j] : 0.0) + c[i][j - 1][x];
+      }
+    }
+    const auto& f = c[n1][n2];
+    double total = 0, tail = 0;
+    for (size_t x = 0; x <= maxU; ++x) {
+      total += f[x];
+      if (double(x) <= u) tail += f[x];
+    }
+    return std::min(1.0, 2.0 * tail / total);
+  }
+
+  const double mean = double(n1) * double(n2) / 2.0;
+  const double var = double(n1) * double(n2) / 12.0 *
+                     (double(n + 1) - tieTerm / (double(n) * double(n - 1)));
+  if (var <= 0) return 1.0;
+  const double z = (mean - u - 0.5) / std::sqrt(var);
+  return std::min(1.0, std::erfc(std::max(0.0, z) / std::sqrt(2.0)));
+}
+
+/**
+ * @brief 표본 크기 (n1, n2)에서 얻을 수 있는 가장 작은 p값
+ *
+ * 두 표본이 완전히 분리된(U = 0) 경우의 p입니다. 동순위는 p를 키우기만
+ * 하므로 이 값이 alpha 이상이면 어떤 결과도 유의하게 나올 수 없습니다.
+ */
+static double minAchievableP(size_t n1, size_t n2) {
+  std::vector<double> a(n1), b(n2);
+  for (size_t i = 0; i < n1; ++i) a[i] = double(i);
+  for (size_t i = 0; i < n2; ++i) b[i] = double(n1 + i);
+  return mannWhitneyP(a, b);
+}
+
+// --- 비교 ---
+struct Options {
+  double thresholdPct = 5.0;
+  double alpha = 0.05;
+  std::string filter;
+  std::string history;
+  size_t historyDepth = 5;
+  std::string label = "candidate";
+  bool record = false;
+  bool failOnMissing = false;
+  bool allowUnderpowered = false;
+  std::vector<std::string> files;
+};
+
+static void usage() {
+  std::cerr
+      << "usage: bench_compare [options] BASELINE.json CANDIDATE.json\n"
+         "       bench_compare --history=FILE --baseline=history "
+         "CANDIDATE.json\n"
+         "  --threshold=PCT      median slowdown counted as regression (5)\n"
+         "  --alpha=P            significance level (0.05)\n"
+         "  --filter=STR         compare only names containing STR\n"
+         "  --history=FILE       baseline history (one result per line)\n"
+         "  --history-depth=N    history entries pooled as baseline (5)\n"
+         "  --record             append candidate to history if gate passes\n"
+         "  --label=STR          label stored with recorded candidate\n"
+         "  --fail-on-missing    treat benchmarks missing in candidate as "
+         "failures\n"
+         "  --allow-underpowered do not fail when reps are too few to reach "
+         "alpha\n";
+}
+
+int main(int argc, char** argv) {
+  Options opt;
+  bool baselineFromHistory = false;
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const std::string arg = argv[i];
+      if (arg.rfind("--threshold=", 0) == 0)
+        opt.thresholdPct = std::stod(arg.substr(12));
+      else if (arg.rfind("--alpha=", 0) == 0)
+        opt.alpha = std::stod(arg.substr(8));
+      else if (arg.rfind("--filter=", 0) == 0)
+        opt.filter = arg.substr(9);
+      else if (arg.rfind("--history=", 0) == 0)
+        opt.history = arg.substr(10);
+      else if (arg.rfind("--history-depth=", 0) == 0)
+        opt.historyDepth = std::max<size_t>(1, std::stoul(arg.substr(16)));
+      else if (arg == "--baseline=history")
+        baselineFromHistory = true;
+      else if (arg.rfind("--label=", 0) == 0)
+        opt.label = arg.substr(8);
+      else if (arg == "--record")
+        opt.record = true;
+      else if (arg == "--fail-on-missing")
+        opt.failOnMissing = true;
+      else if (arg == "--allow-underpowered")
+        opt.allowUnderpowered = true;
+      else if (arg.rfind("--", 0) == 0)
+        throw std::invalid_argument("unknown option " + arg);
+      else
+        opt.files.push_back(arg);
+    }
+    const size_t need = baselineFromHistory ? 1 : 2;
+    if (opt.files.size() != need ||
+        (baselineFromHistory && opt.history.empty()) ||
+        (opt.record && opt.history.empty()))
+      throw std::invalid_argument("bad arguments");
+  } catch (const std::exception& e) {
+    std::cerr << "bench_compare: " << e.what() << "\n";
+    usage();
+    return 2;
+  }
+
+  Samples base, cand;
+  std::string candText;
+  try {
+    if (baselineFromHistory) {
+      const auto entries = readHistory(opt.history, opt.historyDepth);
+      if (entries.empty())
+        throw std::runtime_error("history is empty: " + opt.history);
+      for (const auto& e : entries) {
+        const JsonValue* r = e.find("result");
+        if (r) collectSamples(*r, base);
+      }
+      std::printf("baseline: %zu history entries from %s\n", entries.size(),
+                  opt.history.c_str());
+    } else {
+      const std::string text = readFile(opt.files[0]);
+      collectSamples(JsonParser(text).parse(), base);
+    }
+    candText = readFile(opt.files.back());
+    collectSamples(JsonParser(candText).parse(), cand);
+  } catch (const std::exception& e) {
+    std::cerr << "bench_compare: " << e.what() << "\n";
+    return 2;
+  }
+
+  size_t regressions = 0, improvements = 0, missing = 0, underpowered = 0;
+  std::printf("%-56s %12s %12s %9s %9s  %s\n", "benchmark", "base ns/op",
+              "cand ns/op", "delta", "p", "verdict");
+  for (const auto& [name, b] : base) {
+    if (!opt.filter.empty() && name.find(opt.filter) == std::string::npos)
+      continue;
+    auto it = cand.find(name);
+    if (it == cand.end()) {
+      ++missing;
+      std::printf("%-56s %12.2f %12s %9s %9s  missing\n", name.c_str(),
+                  median(b), "-", "-", "-");
+      continue;
+    }
+    const double mb = median(b), mc = median(it->second);
+    const double delta = mb > 0 ? (mc - mb) / mb * 100.0 : 0.0;
+    const double p = mannWhitneyP(b, it->second);
+    const double minP = minAchievableP(b.size(), it->second.size());
+    const char* verdict = "ok";
+    if (minP >= opt.alpha) {
+      verdict = "underpowered";
+      ++underpowered;
+      std::fprintf(stderr,
+                   "bench_compare: %s: %zu vs %zu reps cannot reach "
+                   "alpha %.3g (minimum p %.4f); increase --reps\n",
+                   name.c_str(), b.size(), it->second.size(), opt.alpha,
+                   minP);
+    } else if (p < opt.alpha && delta > opt.thresholdPct) {
+      verdict = "REGRESSION";
+      ++regressions;
+    } else if (p < opt.alpha && delta < -opt.thresholdPct) {
+      verdict = "improved";
+      ++improvements;
+    } else if (std::fabs(delta) > opt.thresholdPct) {
+      verdict = "noise";  // 차이는 크지만 유의하지 않음 (반복 횟수 부족 등)
+    }
+    std::printf("%-56s %12.2f %12.2f %+8.2f%% %9.4f  %s\n", name.c_str(), mb,
+                mc, delta, p, verdict);
+  }
+  for (const auto& [name, c] : cand)
+    if (!base.count(name) &&
+        (opt.filter.empty() || name.find(opt.filter) != std::string::npos))
+      std::printf("%-56s %12s %12.2f %9s %9s  new\n", name.c_str(), "-",
+                  median(c), "-", "-");
+
+  const bool failed = regressions > 0 ||
+                      (opt.failOnMissing && missing > 0) ||
+                      (!opt.allowUnderpowered && underpowered > 0);
+  std::printf("\n%zu regression(s), %zu improvement(s), %zu missing, "
+              "%zu underpowered (threshold %.2f%%, alpha %.3g)\n",
+              regressions, improvements, missing, underpowered,
+              opt.thresholdPct, opt.alpha);
+
+  if (opt.record && !failed) {
+    try {
+      appendHistory(opt.history, opt.label, candText);
+      std::printf("recorded candidate in %s\n", opt.history.c_str());
+    } catch (const std::exception& e) {
+      std::cerr << "bench_compare: " << e.what() << "\n";
+      return 2;
+    }
+  }
+  return failed ? 1 : 0;
+}
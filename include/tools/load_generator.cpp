@@ -0,0 +1,655 @@
+// 본 소스코드는 BSD 3-Clause 라이선스를 따릅니다.
+// This file is licensed under the BSD 3-Clause License.
+// 개인프로젝트 코드이며 수정, 배포, 상업적이용은 자유로우나 상단 주석을 제거시
+// 저작권 보호법 위반입니다.
+/*
+ * Copyright (c) 2025, 곽동환 <arbiter1225@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the author nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// 합성 부하 발생기: 프레임/포트 그래프를 만들고 목표 속도로 송신하며
+// 처리량, 코어별 CPU, 콜백 지연 백분위를 측정합니다. --ramp 지정 시
+// 송신 속도를 단계적으로 올려 포화 지점을 찾습니다.
+//
+// 빌드 예:
+//   g++ -std=c++20 -O2 -pthread -I<include 상위> load_generator.cpp
+// 실행 예:
+//   ./a.out --frames=1000 --sizes=64,1024 --ports=8 --fanout=2
+//           --rate=50000 --dist=poisson --duration=2 --ramp
+//   ./a.out --spec=load.spec   (한 줄에 key=value, '#' 주석)
+//
+// 옵션 (기본값):
+//   frames=100        프레임 수
+//   sizes=64          프레임 크기 목록 (바이트, 프레임에 순환 배정)
+//   ports=4           포트 수
+//   fanout=1          프레임당 구독 포트 수 (<= ports)
+//   publishers=1      송신 스레드 수
+//   rate=10000        전체 목표 송신 속도 (publish/s)
+//   dist=periodic     periodic | bursty | poisson
+//   burst=16          bursty 분포의 버스트 크기
+//   policy=threaded   콜백 정책: direct | threaded | executor
+//   workers=0         executor 정책의 워커 수 (0: 코어 수)
+//   duration=2        단계별 측정 시간 (초)
+//   seed=1            poisson 난수 시드
+//   ramp              포화 지점 탐색 (rate부터 ramp-factor배씩 증가)
+//   ramp-factor=1.5   단계별 증가 배율
+//   max-rate=1e7      탐색 상한
+//   max-p99-us=0      포화 판정 p99 지연 상한 (0: 사용 안 함)
+//   json=PATH         단계별 결과 JSON 기록
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "com/external/Interface/interface.h"
+
+using SteadyClock = std::chrono::steady_clock;
+
+static int64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             SteadyClock::now().time_since_epoch())
+      .count();
+}
+
+// --- 합성 프레임: 크기 버킷별 타입 ---
+template <size_t Size>
+struct SyntheticPayload {
+  uint64_t seq;                         ///< 송신 순번
+  int64_t sentNs;                       ///< 송신 시각 (steady_clock ns)
+  std::array<uint8_t, Size - 16> body;  ///< 부하용 본문
+};
+
+template <size_t Size>
+class SyntheticFrame
+    : public FrameBase<SyntheticPayload<Size>, SyntheticFrame<Size>> {
+  using Base = FrameBase<SyntheticPayload<Size>, SyntheticFrame<Size>>;
+  using Payload = SyntheticPayload<Size>;
+
+ public:
+  static std::string staticName() {
+    return "SyntheticFrame" + std::to_string(Size);
+  }
+  explicit SyntheticFrame(const std::string& instanceName)
+      : Base(instanceName) {
+    this->registerSignal("seq", &Payload::seq, &this->data_,
+                         &this->data_rwlock_);
+    this->registerSignal("sent_ns", &Payload::sentNs, &this->data_,
+                         &this->data_rwlock_);
+  }
+};
+
+static constexpr std::array<size_t, 8> kSizeBuckets = {
+    16, 64, 256, 1024, 4096, 16384, 65536, 262144};
+
+template <size_t... I>
+static void registerSyntheticFrames(std::index_sequence<I...>) {
+  ((void)AutoRegister<SyntheticFrame<kSizeBuckets[I]>, IFrame>::registered_,
+   ...);
+}
+
+/**
+ * @brief 요청 크기를 담을 수 있는 가장 작은 버킷 (없으면 0)
+ */
+static size_t bucketFor(size_t size) {
+  for (size_t b : kSizeBuckets)
+    if (b >= size) return b;
+  return 0;
+}
+
+// --- 부하용 포트 ---
+class LoadPort : public PortBase<LoadPort> {
+ public:
+  using PortBase::PortBase;
+  static std::string staticName() { return "LoadPort"; }
+  std::string type() const override { return "load"; }
+  bool open() override { return true; }
+  void close() override {}
+};
+
+// --- 지연 히스토그램 (로그-선형, 락 없음, 상대 오차 ~1.6%) ---
+class LatencyHistogram {
+ public:
+  void record(int64_t ns) {
+    const uint64_t v = ns > 0 ? static_cast<uint64_t>(ns) : 0;
+    buckets_[index(v)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void reset() {
+    for (auto& b : buckets_) b.store(0, std::memory_order_relaxed);
+  }
+
+  uint64_t count() const {
+    uint64_t n = 0;
+    for (const auto& b : buckets_) n += b.load(std::memory_order_relaxed);
+    return n;
+  }
+
+  /**
+   * @brief 백분위 값 (ns, 버킷 하한)
+   * @param p 0~100
+   */
+  double percentile(double p) const {
+    const uint64_t total = count();
+    if (total == 0) return 0.0;
+    const uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(p / 100.0 * static_cast<double>(total) + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+      seen += buckets_[i].load(std::memory_order_relaxed);
+      if (seen >= rank) return static_cast<double>(lowerBound(i));
+    }
+    return static_cast<double>(lowerBound(kBuckets - 1));
+  }
+
+ private:
+  static constexpr size_t kSub = 64;  // 2의 거듭제곱 구간당 하위 버킷
+  static constexpr size_t kBuckets = 2 * kSub + 57 * kSub;
+
+  static size_t index(uint64_t v) {
+    if (v < 2 * kSub) return static_cast<size_t>(v);
+    const int shift = std::bit_width(v) - 7;  // v >> shift 는 [64, 127]
+    return 2 * kSub + (shift - 1) * kSub + ((v >> shift) - kSub);
+  }
+
+  static uint64_t lowerBound(size_t i) {
+    if (i < 2 * kSub) return i;
+    const size_t shift = (i - 2 * kSub) / kSub + 1;
+    return (kSub + (i - 2 * kSub) % kSub) << shift;
+  }
+
+  std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+};
+
+// --- CPU 사용률 측정 (/proc/stat 코어별 + getrusage 프로세스) ---
+class CpuSampler {
+ public:
+  void start() {
+    cores_ = readCores();
+    cpuSec_ = processCpuSeconds();
+    wall_ = SteadyClock::now();
+  }
+
+  /**
+   * @brief start 이후 코어별 사용률 (0~1, /proc/stat 없으면 빈 목록)
+   */
+  std::vector<double> coreUtilization() const {
+    const auto now = readCores();
+    std::vector<double> util;
+    for (size_t i = 0; i < now.size() && i < cores_.size(); ++i) {
+      const double total = double(now[i].total - cores_[i].total);
+      const double idle = double(now[i].idle - cores_[i].idle);
+      util.push_back(total > 0 ? 1.0 - idle / total : 0.0);
+    }
+    return util;
+  }
+
+  /**
+   * @brief start 이후 프로세스가 사용한 평균 코어 수
+   */
+  double processCores() const {
+    const double wall =
+        std::chrono::duration<double>(SteadyClock::now() - wall_).count();
+    return wall > 0 ? (processCpuSeconds() - cpuSec_) / wall : 0.0;
+  }
+
+ private:
+  struct CoreTimes {
+    uint64_t total = 0;
+    uint64_t idle = 0;
+  };
+
+  static std::vector<CoreTimes> readCores() {
+    std::vector<CoreTimes> out;
+    std::ifstream in("/proc/stat");
+    std::string line;
+    while (std::getline(in, line)) {
+      // "cpu0 user nice system idle iowait irq softirq steal ..."
+      if (line.rfind("cpu", 0) != 0 || line.size() < 4 ||
+          !std::isdigit(static_cast<unsigned char>(line[3])))
+        continue;
+      std::istringstream ss(line);
+      std::string name;
+      ss >> name;
+      CoreTimes t;
+      uint64_t v;
+      for (int field = 0; field < 8 && ss >> v; ++field) {
+        t.total += v;
+        if (field == 3 || field == 4) t.idle += v;  // idle + iowait
+      }
+      out.push_back(t);
+    }
+    return out;
+  }
+
+  static double processCpuSeconds() {
+    rusage ru{};
+    if (getrusage(RUSAGE_SELF, &ru) != 0) return 0.0;
+    auto sec = [](const timeval& tv) {
+      return double(tv.tv_sec) + double(tv.tv_usec) / 1e6;
+    };
+    return sec(ru.ru_utime) + sec(ru.ru_stime);
+  }
+
+  std::vector<CoreTimes> cores_;
+  double cpuSec_ = 0;
+  SteadyClock::time_point wall_;
+};
+
+// --- 부하 명세 ---
+struct LoadSpec {
+  size_t frames = 100;
+  std::vector<size_t> sizes{64};
+  size_t ports = 4;
+  size_t fanout = 1;
+  size_t publishers = 1;
+  double rate = 10000;
+  std::string dist = "periodic";
+  size_t burst = 16;
+  std::string policy = "threaded";
+  size_t workers = 0;
+  double duration = 2;
+  uint64_t seed = 1;
+  bool ramp = false;
+  double rampFactor = 1.5;
+  double maxRate = 1e7;
+  double maxP99Us = 0;
+  std::string json;
+
+  /**
+   * @brief "key=value" 1건 적용
+   * @throws std::invalid_argument 알 수 없는 키 / 잘못된 값
+   */
+  void apply(const std::string& kv) {
+    const auto eq = kv.find('=');
+    const std::string key = kv.substr(0, eq);
+    const std::string val = eq == std::string::npos ? "" : kv.substr(eq + 1);
+    if (key == "frames") frames = std::stoul(val);
+    else if (key == "sizes") sizes = parseList(val);
+    else if (key == "ports") ports = std::stoul(val);
+    else if (key == "fanout") fanout = std::stoul(val);
+    else if (key == "publishers") publishers = std::stoul(val);
+    else if (key == "rate") rate = std::stod(val);
+    else if (key == "dist") dist = val;
+    else if (key == "burst") burst = std::stoul(val);
+    else if (key == "policy") policy = val;
+    else if (key == "workers") workers = std::stoul(val);
+    else if (key == "duration") duration = std::stod(val);
+    else if (key == "seed") seed = std::stoull(val);
+    else if (key == "ramp") ramp = val.empty() || val == "1" || val == "true";
+    else if (key == "ramp-factor") rampFactor = std::stod(val);
+    else if (key == "max-rate") maxRate = std::stod(val);
+    else if (key == "max-p99-us") maxP99Us = std::stod(val);
+    else if (key == "json") json = val;
+    else throw std::invalid_argument("unknown option: " + key);
+  }
+
+  void applyFile(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::invalid_argument("cannot read spec: " + path);
+    std::string line;
+    while (std::getline(in, line)) {
+      line = line.substr(0, line.find('#'));
+      line.erase(0, line.find_first_not_of(" \t"));
+      line.erase(line.find_last_not_of(" \t\r") + 1);
+      if (!line.empty()) apply(line);
+    }
+  }
+
+  void validate() const {
+    if (frames == 0 || ports == 0 || publishers == 0 || sizes.empty())
+      throw std::invalid_argument("frames, ports, publishers, sizes > 0");
+    if (fanout > ports) throw std::invalid_argument("fanout > ports");
+    if (dist != "periodic" && dist != "bursty" && dist != "poisson")
+      throw std::invalid_argument("dist: periodic | bursty | poisson");
+    if (policy != "direct" && policy != "threaded" && policy != "executor")
+      throw std::invalid_argument("policy: direct | threaded | executor");
+    for (size_t s : sizes)
+      if (bucketFor(s) == 0)
+        throw std::invalid_argument("frame size too large: " +
+                                    std::to_string(s));
+    if (rate <= 0 || duration <= 0 || rampFactor <= 1.0)
+      throw std::invalid_argument("rate, duration > 0, ramp-factor > 1");
+  }
+
+ private:
+  static std::vector<size_t> parseList(const std::string& s) {
+    std::vector<size_t> out;
+    std::istringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) out.push_back(std::stoul(item));
+    return out;
+  }
+};
+
+// --- 부하 그래프 ---
+class LoadGraph {
+ public:
+  explicit LoadGraph(const LoadSpec& spec) : spec_(spec) {
+    if (spec_.policy == "executor")
+      executor_ = std::make_unique<WorkStealingScheduler>(spec_.workers);
+
+    for (size_t p = 0; p < spec_.ports; ++p) {
+      ports_.emplace_back(FactoryRegistry<IPort>::instance().create(
+          "LoadPort", "load.port." + std::to_string(p)));
+      ports_.back()->open();
+    }
+    for (size_t i = 0; i < spec_.frames; ++i) {
+      const size_t size = bucketFor(spec_.sizes[i % spec_.sizes.size()]);
+      const std::string name = "load.frame." + std::to_string(i);
+      std::shared_ptr<IFrame> frame =
+          FactoryRegistry<IFrame>::instance().create(
+              "SyntheticFrame" + std::to_string(size), name);
+      FrameBus::instance().registerFrame(name, frame);
+      frames_.push_back(frame);
+      names_.push_back(name);
+      // 프레임 i 는 포트 i, i+1, ... (fanout개)에 연결
+      for (size_t k = 0; k < spec_.fanout; ++k) {
+        auto& port = ports_[(i + k) % spec_.ports];
+        port->connectFrame(name);
+        subs_.emplace_back(port.get(), subscribe(*port, name));
+      }
+    }
+  }
+
+  ~LoadGraph() {
+    for (auto& [port, id] : subs_) port->unsubscribeFrame(id);
+    for (const auto& name : names_) FrameBus::instance().unregisterFrame(name);
+  }
+
+  const std::vector<std::shared_ptr<IFrame>>& frames() const {
+    return frames_;
+  }
+
+  LatencyHistogram& latency() { return latency_; }
+  uint64_t delivered() const {
+    return delivered_.load(std::memory_order_relaxed);
+  }
+  void resetStats() {
+    latency_.reset();
+    delivered_.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  uint64_t subscribe(IPort& port, const std::string& name) {
+    auto cb = [this](const char* data, size_t size) {
+      if (size < 16) return;
+      int64_t sent;
+      std::memcpy(&sent, data + 8, sizeof(sent));
+      latency_.record(nowNs() - sent);
+      delivered_.fetch_add(1, std::memory_order_relaxed);
+    };
+    if (spec_.policy == "direct") return port.subscribeFrameDirect(name, cb);
+    if (spec_.policy == "executor")
+      return port.subscribeFrameOn(name, *executor_, cb);
+    return port.subscribeFrame(name, cb);
+  }
+
+  const LoadSpec& spec_;
+  std::unique_ptr<WorkStealingScheduler> executor_;
+  std::vector<std::unique_ptr<IPort>> ports_;
+  std::vector<std::shared_ptr<IFrame>> frames_;
+  std::vector<std::string> names_;
+  std::vector<std::pair<IPort*, uint64_t>> subs_;
+  LatencyHistogram latency_;
+  std::atomic<uint64_t> delivered_{0};
+};
+
+// --- 단계 실행 ---
+struct StepResult {
+  double targetRate = 0;
+  double achievedRate = 0;    ///< 실제 송신 속도 (publish/s)
+  double deliveredRatio = 0;  ///< 기대 콜백 대비 전달 비율
+  uint64_t published = 0;
+  uint64_t late = 0;  ///< 예정 시각보다 1ms 이상 늦게 송신된 수
+  double p50Us = 0, p90Us = 0, p99Us = 0, p999Us = 0, maxUs = 0;
+  double processCores = 0;
+  std::vector<double> coreUtil;
+};
+
+/**
+ * @brief 송신 스레드 1개: 분포에 따라 예정 시각을 만들고 해당 시각에 송신
+ */
+static void publishLoop(const LoadSpec& spec, double rate,
+                        const std::vector<std::shared_ptr<IFrame>>& frames,
+                        size_t thread, SteadyClock::time_point end,
+                        std::atomic<uint64_t>& published,
+                        std::atomic<uint64_t>& late) {
+  std::vector<IFrame*> mine;
+  for (size_t i = thread; i < frames.size(); i += spec.publishers)
+    mine.push_back(frames[i].get());
+  if (mine.empty()) return;
+
+  const double gapNs = 1e9 / rate;
+  std::mt19937_64 rng(spec.seed * 1000003 + thread);
+  std::exponential_distribution<double> expo(1.0 / gapNs);
+  uint64_t seq = 0, count = 0, lateCount = 0;
+  double due = 0;  // 시작 기준 ns
+  const auto start = SteadyClock::now();
+  const int64_t startNs = nowNs();
+
+  for (;;) {
+    const auto dueTp =
+        start + std::chrono::nanoseconds(static_cast<int64_t>(due));
+    if (dueTp >= end) break;
+    auto now = SteadyClock::now();
+    if (dueTp - now > std::chrono::microseconds(100))
+      std::this_thread::sleep_for(dueTp - now - std::chrono::microseconds(50));
+    while ((now = SteadyClock::now()) < dueTp) {
+    }
+    if (nowNs() - startNs - static_cast<int64_t>(due) > 1000000) ++lateCount;
+
+    IFrame* frame = mine[seq % mine.size()];
+    ++seq;
+    const int64_t sent = nowNs();
+    frame->writeRawData([&](char* p, size_t) {
+      std::memcpy(p, &seq, sizeof(seq));
+      std::memcpy(p + 8, &sent, sizeof(sent));
+    });
+    frame->notifyCallbacks();
+    ++count;
+
+    if (spec.dist == "periodic") {
+      due += gapNs;
+    } else if (spec.dist == "bursty") {
+      // burst개를 연달아 보낸 뒤 burst 간격만큼 쉼 (평균 속도 유지)
+      if (count % spec.burst == 0) due += gapNs * double(spec.burst);
+    } else {
+      due += expo(rng);
+    }
+  }
+  published.fetch_add(count, std::memory_order_relaxed);
+  late.fetch_add(lateCount, std::memory_order_relaxed);
+}
+
+static StepResult runStep(const LoadSpec& spec, LoadGraph& graph,
+                          double rate) {
+  graph.resetStats();
+  std::atomic<uint64_t> published{0}, late{0};
+  CpuSampler cpu;
+  cpu.start();
+  const auto t0 = SteadyClock::now();
+  const auto end =
+      t0 + std::chrono::nanoseconds(static_cast<int64_t>(spec.duration * 1e9));
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < spec.publishers; ++t)
+    threads.emplace_back([&, t] {
+      publishLoop(spec, rate / double(spec.publishers), graph.frames(), t, end,
+                  published, late);
+    });
+  for (auto& th : threads) th.join();
+  const double elapsed =
+      std::chrono::duration<double>(SteadyClock::now() - t0).count();
+
+  // 잔여 콜백 대기 (측정 시간의 10%, 최소 100ms)
+  const uint64_t expected = published.load() * spec.fanout;
+  const auto grace = SteadyClock::now() +
+                     std::chrono::milliseconds(std::max<int64_t>(
+                         100, static_cast<int64_t>(spec.duration * 100)));
+  while (graph.delivered() < expected && SteadyClock::now() < grace)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  StepResult r;
+  r.targetRate = rate;
+  r.published = published.load();
+  r.late = late.load();
+  r.achievedRate = elapsed > 0 ? double(r.published) / elapsed : 0;
+  r.deliveredRatio = expected ? double(graph.delivered()) / double(expected)
+                              : 1.0;
+  auto& h = graph.latency();
+  r.p50Us = h.percentile(50) / 1e3;
+  r.p90Us = h.percentile(90) / 1e3;
+  r.p99Us = h.percentile(99) / 1e3;
+  r.p999Us = h.percentile(99.9) / 1e3;
+  r.maxUs = h.percentile(100) / 1e3;
+  r.processCores = cpu.processCores();
+  r.coreUtil = cpu.coreUtilization();
+
+  // 다음 단계에 남은 콜백이 섞이지 않도록 배출 대기
+  const auto drain = SteadyClock::now() + std::chrono::seconds(10);
+  while (graph.delivered() < expected && SteadyClock::now() < drain)
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  return r;
+}
+
+static bool saturated(const LoadSpec& spec, const StepResult& r) {
+  if (r.achievedRate < 0.95 * r.targetRate) return true;
+  if (r.deliveredRatio < 0.99) return true;
+  return spec.maxP99Us > 0 && r.p99Us > spec.maxP99Us;
+}
+
+static void printHeader() {
+  std::printf("%12s %12s %8s %9s %9s %9s %9s %9s %7s %s\n", "target/s",
+              "achieved/s", "deliv%", "p50us", "p90us", "p99us", "p999us",
+              "maxus", "cores", "core util %");
+}
+
+static void printStep(const StepResult& r) {
+  std::string util;
+  for (double u : r.coreUtil) util += std::to_string(int(u * 100 + 0.5)) + " ";
+  std::printf("%12.0f %12.0f %8.2f %9.1f %9.1f %9.1f %9.1f %9.1f %7.2f %s\n",
+              r.targetRate, r.achievedRate, r.deliveredRatio * 100, r.p50Us,
+              r.p90Us, r.p99Us, r.p999Us, r.maxUs, r.processCores,
+              util.c_str());
+}
+
+static void writeJson(const LoadSpec& spec,
+                      const std::vector<StepResult>& steps, double saturation) {
+  std::ofstream out(spec.json);
+  if (!out) {
+    std::cerr << "load_generator: cannot write " << spec.json << "\n";
+    return;
+  }
+  out << "{\"format\":\"nexum-load\",\"version\":1,\"policy\":\""
+      << spec.policy << "\",\"dist\":\"" << spec.dist
+      << "\",\"frames\":" << spec.frames << ",\"ports\":" << spec.ports
+      << ",\"fanout\":" << spec.fanout << ",\"saturation_rate\":" << saturation
+      << ",\"steps\":[";
+  for (size_t i = 0; i < steps.size(); ++i) {
+    const StepResult& r = steps[i];
+    out << (i ? ",\n" : "\n") << "{\"target\":" << r.targetRate
+        << ",\"achieved\":" << r.achievedRate
+        << ",\"delivered_ratio\":" << r.deliveredRatio
+        << ",\"p50_us\":" << r.p50Us << ",\"p90_us\":" << r.p90Us
+        << ",\"p99_us\":" << r.p99Us << ",\"p999_us\":" << r.p999Us
+        << ",\"max_us\":" << r.maxUs << ",\"cores\":" << r.processCores
+        << ",\"core_util\":[";
+    for (size_t c = 0; c < r.coreUtil.size(); ++c)
+      out << (c ? "," : "") << r.coreUtil[c];
+    out << "]}";
+  }
+  out << "\n]}\n";
+}
+
+int main(int argc, char** argv) {
+  LoadSpec spec;
+  try {
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      if (arg.rfind("--", 0) == 0) arg = arg.substr(2);
+      if (arg.rfind("spec=", 0) == 0)
+        spec.applyFile(arg.substr(5));
+      else
+        spec.apply(arg);
+    }
+    spec.validate();
+  } catch (const std::exception& e) {
+    std::cerr << "load_generator: " << e.what() << "\n";
+    return 2;
+  }
+
+  registerSyntheticFrames(std::make_index_sequence<kSizeBuckets.size()>{});
+  (void)AutoRegister<LoadPort, IPort>::registered_;
+  LoadGraph graph(spec);
+
+  std::printf("frames=%zu ports=%zu fanout=%zu publishers=%zu dist=%s "
+              "policy=%s\n",
+              spec.frames, spec.ports, spec.fanout, spec.publishers,
+              spec.dist.c_str(), spec.policy.c_str());
+  printHeader();
+
+  std::vector<StepResult> steps;
+  double saturation = 0;
+  for (double rate = spec.rate;; rate *= spec.rampFactor) {
+    steps.push_back(runStep(spec, graph, rate));
+    printStep(steps.back());
+    if (!spec.ramp) break;
+    if (saturated(spec, steps.back())) {
+      std::printf("saturation: %.0f publish/s sustained, %.0f publish/s "
+                  "not sustained\n",
+                  saturation, rate);
+      break;
+    }
+    saturation = rate;
+    if (rate * spec.rampFactor > spec.maxRate) {
+      std::printf("no saturation up to max-rate (%.0f publish/s)\n",
+                  spec.maxRate);
+      break;
+    }
+  }
+  if (!spec.json.empty()) writeJson(spec, steps, saturation);
+  return 0;
+}